@@ -1,9 +1,22 @@
 
 #include "xml_std_parsers.hpp"
 #include "xml_attributes.hpp"
+#include "xml_parallel.hpp"
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <new>
 
+// counts heap allocations, so main can report allocations per element
+static std::size_t allocation_count = 0;
+void* operator new(std::size_t size) {
+	++allocation_count;
+	if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+	throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
 // simple class heiarchy
 struct three {
 	int attr1;
@@ -13,7 +26,7 @@ struct two {
 	int attr1;
 	std::string attr2;
 	std::vector<three> nodes;
-	std::vector<std::string> texts;
+	std::vector<std::pair<std::size_t, std::string>> texts; //each with the count of nodes before it, to write them back in document order
 };
 struct one {
 	int attr1;
@@ -30,20 +43,20 @@ struct one {
 	void reset() 
 	{ attr1.reset(); }
 	three_parser parse_tag(mpd::xml::tag_reader& reader, const std::string&) { return reader.read_element(*this); }
-	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string&& value) 
-	{ mpd::xml::read_element(reader, name, std::move(value))("attr1", attr1)("attr2", attr2); }
+	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string_view value) 
+	{ mpd::xml::read_element(reader, name, value)("attr1", attr1)("attr2", attr2); }
 	three_parser& parse_content(mpd::xml::attribute_reader& reader)
 	{ mpd::xml::require_attributes(reader)("attr1", attr1)("attr2", attr2); return *this; }
 	three end_parse(mpd::xml::base_reader&) {
 		return three{ *std::move(attr1), *std::move(attr2) };
 	}
 };*/
-extern const char attr1_string[] = "attr1";
-extern const char attr2_string[] = "attr2";
+inline constexpr char attr1_string[] = "attr1";
+inline constexpr char attr2_string[] = "attr2";
 using three_parser = mpd::xml::builder::parser<three,
 	std::tuple<>, //elements
 	std::tuple<	//attributes
-		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::strtoi_parser<int, long, std::strtol>), &three::attr1),
+		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::from_chars_parser<int>), &three::attr1),
 		mpd_xml_builder_attribute(attr2_string, std::move<std::string&&>, &three::attr2)
 	>
 >;
@@ -52,39 +65,52 @@ struct two_parser {
 	std::optional<int> attr1;
 	std::optional<std::string> attr2;
 	std::vector<three> nodes;
-	std::vector<std::string> texts;
+	std::vector<std::pair<std::size_t, std::string>> texts;
+	three_parser child_parser;
 
 	void reset() 
-	{ attr1.reset(); attr2.reset(); }
+	{ attr1.reset(); attr2.reset(); nodes.clear(); texts.clear(); }
 	two parse_tag(mpd::xml::tag_reader& reader, const std::string&) { return reader.read_element(*this); }
-	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string&& value)
-	{ mpd::xml::read_element(reader, name, std::move(value))("attr1", attr1)("attr2", attr2); }
+	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string_view value)
+	{ mpd::xml::read_element(reader, name, value)("attr1", attr1)("attr2", attr2); }
 	two_parser& parse_content(mpd::xml::base_reader& reader)
 	{ mpd::xml::require_attributes(reader)("attr1", attr1)("attr2", attr2); return *this; }
 	void parse_child_element(mpd::xml::element_reader& reader, const std::string& content) {
-		if (content == "three") nodes.emplace_back(reader.read_child(three_parser{}));
+		if (content == "three") nodes.emplace_back(reader.read_child(child_parser));
 		else reader.throw_unexpected();
 	}
 	void parse_child_node(mpd::xml::base_reader& reader, mpd::xml::node_type type, std::string&& content) {
 		if (type == mpd::xml::node_type::string_node) {
 			if (content.find("_") != -1) reader.throw_invalid_content("two-class strings can't contain _");
-			texts.push_back(content);
+			texts.emplace_back(nodes.size(), std::move(content));
 		} else if (type == mpd::xml::node_type::comment_node) std::cout << "two-comment: " << content << '\n';
 		else if (type == mpd::xml::node_type::processing_node) std::cout << "two-PN: " << content << '\n';
 	}
 	two end_parse(mpd::xml::attribute_reader&) 
-	{ return two{ *std::move(attr1), *std::move(attr2), std::move(nodes), std::move(texts) }; }
+	{ return two{ *std::move(attr1), *std::move(attr2), mpd::xml::move_out(nodes), mpd::xml::move_out(texts) }; }
+	void write_element(mpd::xml::document_writer& writer, const char* tag, const two& item) const {
+		writer.start_element(tag);
+		writer.attribute("attr1", item.attr1);
+		writer.attribute("attr2", item.attr2);
+		std::size_t written_nodes = 0;
+		for (const auto& [nodes_before, text] : item.texts) {
+			for (; written_nodes < nodes_before; ++written_nodes) writer.write_child("three", child_parser, item.nodes[written_nodes]);
+			writer.text(text);
+		}
+		for (; written_nodes < item.nodes.size(); ++written_nodes) writer.write_child("three", child_parser, item.nodes[written_nodes]);
+		writer.end_element();
+	}
 };
 /*
 Builder would look like this, but builder can't handle comments nor processing nodes
 void add_three_to_two(two& parent, three&& child) {parent.nodes.emplace_back(std::move(child));}
-void add_text_to_two(two& parent, std::string&& child) {parent.texts.emplace_back(std::move(child));}
+void add_text_to_two(two& parent, std::string&& child) {parent.texts.emplace_back(parent.nodes.size(), std::move(child));}
 using two_parser = mpd::xml::builder::parser<two,
 	std::tuple<	//elements
 		mpd_xml_builder_element_repeating("three", three_parser, add_three_to_two)
 	>,
 	std::tuple<	//attributes
-		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::strtoi_parser<int, long, std::strtol>), &two::attr1),
+		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::from_chars_parser<int>), &two::attr1),
 		mpd_xml_builder_attribute(attr2_string, std::move<std::string&&>, &two::attr2)
 	>,
 	mpd_xml_builder_text(std::move<std::string&&>, add_text_to_two) //texts
@@ -95,17 +121,18 @@ struct one_parser {
 	std::optional<int> attr1;
 	std::optional<std::string> attr2;
 	std::vector<two> nodes;
+	two_parser child_parser;
 
 	void reset() 
-	{ attr1.reset(); attr2.reset(); }
+	{ attr1.reset(); attr2.reset(); nodes.clear(); }
 	one parse_tag(mpd::xml::tag_reader& reader, const std::string&) { return reader.read_element(*this); }
-	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string&& value)
-	{ mpd::xml::read_element(reader, name, std::move(value))("attr1", attr1)("attr2", attr2); }
+	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string& name, std::string_view value)
+	{ mpd::xml::read_element(reader, name, value)("attr1", attr1)("attr2", attr2); }
 	one_parser& parse_content(mpd::xml::base_reader& reader) 
 	{ mpd::xml::require_attributes(reader)("attr1", attr1)("attr2", attr2); return *this; }
 	void parse_child_element(mpd::xml::element_reader& reader, const std::string& content) {
 		if (content == "two") {
-			try { nodes.emplace_back(reader.read_child(two_parser{})); }
+			try { nodes.emplace_back(reader.read_child(child_parser)); }
 			catch (std::runtime_error& e) { std::cerr << "SUCCESSFULLY HANDLED ERROR: " << e.what() << '\n'; }
 		} else reader.throw_unexpected();
 	}
@@ -113,6 +140,13 @@ struct one_parser {
 	{ if (type == mpd::xml::node_type::string_node) std::cout << "one-str: " << content << '\n'; }
 	one end_parse(mpd::xml::attribute_reader&) 
 	{ return one{ *std::move(attr1), *std::move(attr2), std::move(nodes) }; }
+	void write_element(mpd::xml::document_writer& writer, const char* tag, const one& item) const {
+		writer.start_element(tag);
+		writer.attribute("attr1", item.attr1);
+		writer.attribute("attr2", item.attr2);
+		for (const two& node : item.nodes) writer.write_child("two", child_parser, node);
+		writer.end_element();
+	}
 };
 /*
 Builder would look like this, but builder doesn't catch that exception
@@ -123,13 +157,56 @@ using one_parser = mpd::xml::builder::parser<one,
 		mpd_xml_builder_element_repeating("two", two_parser, add_two_to_one)
 	>,
 	std::tuple<	//attributes
-		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::strtoi_parser<int, long, std::strtol>), &one::attr1),
+		mpd_xml_builder_attribute(attr1_string, (mpd::xml::impl::from_chars_parser<int>), &one::attr1),
 		mpd_xml_builder_attribute(attr2_string, std::move<std::string&&>,&one::attr2)
 	>,
 	mpd_xml_builder_text(std::move<std::string&&>, add_text_to_one)	//texts
 >;
 */
 
+// an element with 64 kinds of children, to time finding a child's parser by name
+struct leaf {};
+struct wide { std::size_t count = 0; };
+using leaf_parser = mpd::xml::builder::parser<leaf, std::tuple<>>;
+void add_leaf(wide& parent, leaf&&) { ++parent.count; }
+constexpr std::size_t wide_child_count = 64;
+template<std::size_t I>
+inline constexpr char wide_child_name[] = { 'c', 'h', 'i', 'l', 'd', '_', char('0' + I / 10), char('0' + I % 10), '\0' };
+template<std::size_t... Is>
+mpd::xml::builder::parser<wide, std::tuple<mpd_xml_builder_element_repeating(wide_child_name<Is>, leaf_parser, add_leaf)...>> make_wide_parser(std::index_sequence<Is...>);
+using wide_parser = decltype(make_wide_parser(std::make_index_sequence<wide_child_count>{})); //finds children in a name_table
+// finds children by comparing the name to each in turn, as builder::parser did before it had a name_table
+struct wide_fold_parser {
+	using element_type = wide;
+	wide item;
+	leaf_parser child_parser;
+
+	void reset() { item = {}; }
+	wide parse_tag(mpd::xml::tag_reader& reader, const std::string&) { return reader.read_element(*this); }
+	void parse_attribute(mpd::xml::attribute_reader& reader, const std::string&, std::string_view) { reader.throw_unexpected(); }
+	wide_fold_parser& parse_content(mpd::xml::base_reader&) { return *this; }
+	void parse_child_element(mpd::xml::element_reader& reader, const std::string& tag) {
+		if (!fold_children(reader, tag, std::make_index_sequence<wide_child_count>{})) reader.throw_unexpected("unexpected tag " + tag);
+	}
+	template<std::size_t... Is>
+	bool fold_children(mpd::xml::element_reader& reader, const std::string& tag, std::index_sequence<Is...>) 
+	{ return ((tag == wide_child_name<Is> && (add_leaf(item, reader.read_child(child_parser)), true)) || ...); }
+	void parse_child_node(mpd::xml::base_reader&, mpd::xml::node_type, std::string_view) {}
+	wide end_parse(mpd::xml::base_reader&) { return item; }
+};
+// the best of a few runs, in nanoseconds per child
+template<class parser_t>
+double time_per_child(const std::string& document, std::size_t child_count) {
+	double best = 0;
+	for (int run = 0; run < 3; ++run) {
+		auto start = std::chrono::steady_clock::now();
+		mpd::xml::document_reader reader("wide literal", document);
+		if (reader.read_child("wide", parser_t{}).count != child_count) std::cerr << "miscounted children\n";
+		double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		if (run == 0 || elapsed < best) best = elapsed;
+	}
+	return best / child_count;
+}
 
 int main() {
     char buffer[] =
@@ -167,6 +244,74 @@ int main() {
 
     //parser.readRoot("ted", main);
 
+	// allocations per element for a document of many small elements, with names too long for the small string optimization
+	const std::size_t record_count = 100000;
+	std::string big = "<catalog_of_many_records>";
+	for (std::size_t i = 0; i < record_count; ++i)
+		big += "<record_with_a_long_name id=\"1\"><field_with_a_long_name>text</field_with_a_long_name></record_with_a_long_name>";
+	big += "</catalog_of_many_records>";
+	mpd::xml::document_reader big_parser("big literal", big);
+	std::size_t allocations_before = allocation_count;
+	big_parser.read_child("catalog_of_many_records", mpd::xml::IgnoredXmlParser{});
+	std::cout << "allocations per element: " << double(allocation_count - allocations_before) / (record_count * 2 + 1) << '\n';
+
+	// allocations per element when parsing the one/two/three hierarchy above into its structs
+	const std::size_t two_count = 20000;
+	std::string hierarchy = "<one attr1=\"1\" attr2=\"a\">";
+	for (std::size_t i = 0; i < two_count; ++i)
+		hierarchy += "<two attr1=\"2\" attr2=\"b\">text<three attr1=\"3\" attr2=\"c\"/><three attr1=\"4\" attr2=\"d\"/><three attr1=\"5\" attr2=\"e\"/>text</two>";
+	hierarchy += "</one>";
+	mpd::xml::document_reader hierarchy_parser("hierarchy literal", hierarchy);
+	allocations_before = allocation_count;
+	one hierarchy_data = hierarchy_parser.read_child("one", one_parser{});
+	std::cout << "allocations per one/two/three element: " << double(allocation_count - allocations_before) / (two_count * 4 + 1) << '\n';
+
+	// and writing it back out allocates nothing, once the writer's buffer has grown
+	mpd::xml::document_writer writer;
+	writer.write_child("one", one_parser{}, hierarchy_data);
+	writer.clear();
+	allocations_before = allocation_count;
+	writer.write_child("one", one_parser{}, hierarchy_data);
+	std::cout << "allocations writing " << writer.view().size() << " bytes: " << allocation_count - allocations_before << '\n';
+
+	// the time to find and parse each of a wide element's children, by comparing names in turn, and by name_table
+	const std::size_t wide_count = 200000;
+	std::string wide_document = "<wide>";
+	for (std::size_t i = 0; i < wide_count; ++i) {
+		std::size_t child = i * 37 % wide_child_count; //every kind, in no particular order
+		wide_document.append("<child_").append(1, char('0' + child / 10)).append(1, char('0' + child % 10)).append("/>");
+	}
+	wide_document += "</wide>";
+	std::cout << "ns per child of 64 kinds, comparing names: " << time_per_child<wide_fold_parser>(wide_document, wide_count) << '\n';
+	std::cout << "ns per child of 64 kinds, by name_table: " << time_per_child<wide_parser>(wide_document, wide_count) << '\n';
+
+	// the throughput of reading a list of 10M numbers, as in a large COLLADA or SVG coordinate list
+	const std::size_t sample_count = 10000000;
+	std::string samples = "<samples>";
+	for (std::size_t i = 0; i < sample_count; ++i)
+		samples.append(std::to_string(i % 1000)).append(1, '.').append(std::to_string(i % 7)).append(1, ' ');
+	samples += "</samples>";
+	auto samples_start = std::chrono::steady_clock::now();
+	mpd::xml::document_reader samples_parser("samples literal", samples);
+	if (samples_parser.read_child("samples", mpd::xml::numeric_array_parser<double>{}).size() != sample_count) std::cerr << "miscounted samples\n";
+	double samples_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - samples_start).count();
+	std::cout << "MB/s reading " << sample_count << " numbers: " << samples.size() / samples_seconds / 1e6 << " (" << samples_seconds * 1e9 / sample_count << " ns each)\n";
+
+	// how reading the one/two/three document's two records scales with threads, the best of a few runs each
+	double one_thread_ms = 0;
+	for (std::size_t thread_count : {1, 2, 4, 8, 16}) {
+		double best_ms = 0;
+		for (int run = 0; run < 3; ++run) {
+			auto start = std::chrono::steady_clock::now();
+			mpd::xml::document_reader records_parser("hierarchy literal", hierarchy);
+			if (mpd::xml::read_records_parallel(records_parser, "one", "two", two_parser{}, thread_count).size() != two_count) std::cerr << "miscounted records\n";
+			double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			if (run == 0 || elapsed_ms < best_ms) best_ms = elapsed_ms;
+		}
+		if (thread_count == 1) one_thread_ms = best_ms;
+		std::cout << "ms reading " << two_count << " records on " << thread_count << " threads: " << best_ms << " (" << one_thread_ms / best_ms << "x)\n";
+	}
+
     return 0;
 }
  
\ No newline at end of file
@@ -1,83 +1,97 @@
 #pragma once
+#include "xml_numbers.hpp"
 #include "xml_reader.hpp"
-#include <limits>
 #include <optional>
 
 namespace mpd {
 	namespace xml {
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<std::string>& attribute, const std::string& found_attribute, std::string&& value)
+		// parse_attribute_value parses the value of an attribute that is already known to be the desired one.
+		// Numbers are parsed straight from a std::string_view, so parsers that take the value as one don't allocate for them.
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<std::string>& attribute, std::string&& value)
 		{
-			if (found_attribute != desired_attribute) return false;
 			if (attribute.has_value()) reader.throw_unexpected("duplicate attribute "s + desired_attribute);
 			attribute.emplace(std::move(value));
-			return true;
+		}
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<std::string>& attribute, std::string_view value)
+		{
+			if (attribute.has_value()) reader.throw_unexpected("duplicate attribute "s + desired_attribute);
+			attribute.emplace(value);
 		}
 
-		template<class R, R F(const char*, char**, int), class T>
-		bool try_read_int_attribute_helper(attribute_reader& reader, const char* desired_attribute, std::optional<T>& attribute, const std::string& found_attribute, std::string&& value) {
-			if (found_attribute != desired_attribute) return false;
+		template<class T>
+		void read_number_attribute_helper(attribute_reader& reader, const char* desired_attribute, std::optional<T>& attribute, std::string_view value) {
 			if (attribute.has_value()) reader.throw_unexpected("duplicate attribute "s + desired_attribute);
-			char* end = 0;
-			R temp = F(value.c_str(), &end, 10);
-			if (end != value.data() + value.length())
-				reader.throw_invalid_content("could not parse entire input for "s + desired_attribute);
-			if (temp > std::numeric_limits<T>::max() || temp < std::numeric_limits<T>::min())
-				reader.throw_invalid_content("out of range for "s + desired_attribute);
-			attribute.emplace(static_cast<T>(temp));
-			return true;
+			attribute.emplace(impl::from_chars_parser<T>(reader, value));
 		}
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<char>& att, const std::string& found_attribute, std::string&& value) 
-		{ return try_read_int_attribute_helper<long, std::strtol>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<signed char>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<long, std::strtol>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<short>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<long, std::strtol>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<int>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<long, std::strtol>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<long>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<long, std::strtol>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<long long>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<long long, std::strtoll>(reader, desired_attribute, att, found_attribute, std::move(value)); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<char>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<signed char>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<short>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<int>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<long>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<long long>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
 
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned char>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<unsigned long, std::strtoul>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned short>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<unsigned long, std::strtoul>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned int>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<unsigned long, std::strtoul>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned long>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<unsigned long, std::strtoul>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned long long>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_int_attribute_helper<unsigned long long, std::strtoull>(reader, desired_attribute, att, found_attribute, std::move(value)); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned char>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned short>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned int>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned long>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<unsigned long long>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
 
-		template<class T, T F(const char*, char**)>
-		bool try_read_float_attribute_helper(attribute_reader& reader, const char* desired_attribute, std::optional<T>& attribute, const std::string& found_attribute, std::string&& value) {
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<float>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<double>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+		inline void parse_attribute_value(attribute_reader& reader, const char* desired_attribute, std::optional<long double>& att, std::string_view value)
+		{ read_number_attribute_helper(reader, desired_attribute, att, value); }
+
+		// value is a std::string&&, to move into a std::optional<std::string>, or a std::string_view.
+		template<class T, class value_t>
+		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<T>& attribute, const std::string& found_attribute, value_t&& value) {
 			if (found_attribute != desired_attribute) return false;
-			if (attribute.has_value()) reader.throw_unexpected("duplicate attribute "s + desired_attribute);
-			char* end = 0;
-			T temp = F(value.c_str(), &end);
-			if (end != value.data() + value.length())
-				reader.throw_invalid_content("could not parse entire input for "s + desired_attribute);
-			attribute.emplace(temp);
+			parse_attribute_value(reader, desired_attribute, attribute, std::forward<value_t>(value));
+			return true;
+		}
+		// Symbol overload, which compares interned ids instead of strings.
+		template<class T, class value_t>
+		bool try_parse_attribute(attribute_reader& reader, symbol_id desired_attribute, std::optional<T>& attribute, symbol_id found_attribute, value_t&& value) {
+			if (found_attribute != desired_attribute) return false;
+			parse_attribute_value(reader, reader.symbols().name(desired_attribute).c_str(), attribute, std::forward<value_t>(value));
 			return true;
 		}
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<float>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_float_attribute_helper<float, std::strtof>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<double>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_float_attribute_helper<double, std::strtod>(reader, desired_attribute, att, found_attribute, std::move(value)); }
-		bool try_parse_attribute(attribute_reader& reader, const char* desired_attribute, std::optional<long double>& att, const std::string& found_attribute, std::string&& value)
-		{ return try_read_float_attribute_helper<long double, std::strtold>(reader, desired_attribute, att, found_attribute, std::move(value)); }
 
+		// From parse_attribute, with the value as a std::string_view, or as a std::string&& to move into a std::optional<std::string>.
 		struct read_element {
 			attribute_reader& reader_;
 			const std::string& found_attribute_;
-			std::string&& value_;
+			std::string_view value_;
+			std::string* owned_value_; //null if the value is only viewed
 			bool done;
+			read_element(attribute_reader& reader, const std::string& found_attribute, std::string_view value) 
+				:reader_(reader), found_attribute_(found_attribute), value_(value), owned_value_(nullptr), done(false) {}
 			read_element(attribute_reader& reader, const std::string& found_attribute, std::string&& value) 
-				:reader_(reader), found_attribute_(found_attribute), value_(std::move(value)), done(false) {}
+				:reader_(reader), found_attribute_(found_attribute), value_(value), owned_value_(&value), done(false) {}
+			template<class T>
+			read_element& operator()(const char* desired_attribute, std::optional<T>& attribute) {
+				if (!done) done = owned_value_ ? try_parse_attribute(reader_, desired_attribute, attribute, found_attribute_, std::move(*owned_value_))
+					: try_parse_attribute(reader_, desired_attribute, attribute, found_attribute_, value_);
+				return *this;
+			}
 			template<class T>
-			read_element& operator()(const char* desired_attribute, std::optional<T>& attribute)
-			{ done = done || try_parse_attribute(reader_, desired_attribute, attribute, found_attribute_, std::move(value_)); return *this; }
+			read_element& operator()(symbol_id desired_attribute, std::optional<T>& attribute) {
+				if (!done) done = owned_value_ ? try_parse_attribute(reader_, desired_attribute, attribute, reader_.name_id(), std::move(*owned_value_))
+					: try_parse_attribute(reader_, desired_attribute, attribute, reader_.name_id(), value_);
+				return *this;
+			}
 			~read_element() { if (!done && !std::uncaught_exceptions()) reader_.throw_unexpected("unexpected attribute "s + found_attribute_); }
 		};
 
@@ -87,6 +101,9 @@ namespace mpd {
 			template<class T>
 			require_attributes& operator()(const char* name, const std::optional<T>& attribute)
 			{ if (!attribute.has_value()) reader_.throw_missing(mpd::xml::node_type::attribute_node, name); return *this;}
+			template<class T>
+			require_attributes& operator()(symbol_id name, const std::optional<T>& attribute)
+			{ if (!attribute.has_value()) reader_.throw_missing(mpd::xml::node_type::attribute_node, reader_.symbols().name(name).c_str()); return *this;}
 		};
 	}
 }
\ No newline at end of file
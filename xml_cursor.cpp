@@ -0,0 +1,100 @@
+#include "xml_cursor.hpp"
+
+namespace mpd {
+	namespace xml {
+		static constexpr const char* cursor_event_strs[] = { "start_element", "attribute", "end_element", "text", "comment", "processing_instruction", "end_document", "need_input" };
+		const char* cursor_event_to_s(cursor_event event) {
+			return cursor_event_strs[static_cast<int>(event)];
+		}
+
+		cursor::cursor(document_reader& document)
+			: cursor(document.reader_) 
+		{}
+		cursor::cursor(impl::reader& reader)
+			: reader_(&reader) {
+			if (reader_->position.state != impl::reader::parse_state::document_begin) reader_->throw_invalid_read_call("a cursor must start at the beginning of the document");
+		}
+		cursor_event cursor::next() {
+			using parse_state = impl::reader::parse_state;
+			impl::reader& reader = *reader_;
+			if (finished_) return event_;
+			reader.require_recoverable();
+			if (reader.position.state == parse_state::after_tag_name || reader.position.state == parse_state::after_attribute) {
+				if (reader.next_attribute()) return event_ = cursor_event::attribute;
+			}
+			if (reader.position.state == parse_state::before_tag_finish && !reader.finish_tag()) return event_ = cursor_event::end_element;
+			if (reader.at_eof()) {
+				if (reader.source_ && reader.source_->more_input()) return event_ = cursor_event::need_input;
+				if (reader.position.tag_depth != 0) reader.throw_unexpeced_eof("missing close tag for " + reader.symbols_->name(reader.tag_ids[reader.position.tag_depth - 1]));
+				finished_ = true;
+				return event_ = cursor_event::end_document;
+			}
+			switch (reader.read_node()) {
+			case impl::reader::read_result::node:
+				switch (reader.node.first) {
+				case node_type::element_node: 
+					reader.begin_attributes();
+					return event_ = cursor_event::start_element;
+				case node_type::string_node: return event_ = cursor_event::text;
+				case node_type::comment_node: return event_ = cursor_event::comment;
+				default: return event_ = cursor_event::processing_instruction;
+				}
+			case impl::reader::read_result::close_tag: return event_ = cursor_event::end_element;
+			default: return next(); //a DOCTYPE, which has no event
+			}
+		}
+		std::string_view cursor::name() const {
+			symbol_id id = name_id();
+			if (id == no_symbol) return {};
+			return reader_->symbols_->name(id);
+		}
+		symbol_id cursor::name_id() const {
+			switch (event_) {
+			case cursor_event::start_element:
+			case cursor_event::end_element: return reader_->tag_ids[reader_->position.tag_depth];
+			case cursor_event::attribute: return reader_->attribute_id;
+			default: return no_symbol;
+			}
+		}
+		symbol_id cursor::namespace_id() const {
+			if (!reader_->namespaces_enabled()) reader_->throw_invalid_read_call("namespaces aren't enabled. Call document_reader#enable_namespaces before reading");
+			return reader_->resolve_namespace(name_id(), event_ == cursor_event::attribute);
+		}
+		symbol_id cursor::local_name_id() const {
+			symbol_id id = name_id();
+			return id == no_symbol ? no_symbol : reader_->namespaces_.split(id, *reader_->symbols_).local;
+		}
+		std::string_view cursor::value() const {
+			switch (event_) {
+			case cursor_event::attribute:
+			case cursor_event::text:
+			case cursor_event::comment:
+			case cursor_event::processing_instruction: return reader_->node_value;
+			default: return {};
+			}
+		}
+		std::size_t cursor::depth() const {
+			return reader_->position.tag_depth;
+		}
+		bool cursor::next_attribute() {
+			using parse_state = impl::reader::parse_state;
+			if (event_ != cursor_event::start_element && event_ != cursor_event::attribute) reader_->throw_invalid_read_call("next_attribute must follow a start_element or attribute event");
+			if (reader_->position.state != parse_state::after_tag_name && reader_->position.state != parse_state::after_attribute) return false;
+			if (!reader_->next_attribute()) return false;
+			event_ = cursor_event::attribute;
+			return true;
+		}
+		void cursor::skip_element() {
+			if (event_ != cursor_event::start_element && event_ != cursor_event::attribute) reader_->throw_invalid_read_call("skip_element must follow a start_element or attribute event");
+			reader_->skip_element();
+			event_ = cursor_event::end_element;
+		}
+		base_reader& cursor::reader() {
+			return static_cast<tag_reader&>(*reader_);
+		}
+		void cursor::require_start_element(const char* method) {
+			if (event_ != cursor_event::start_element || reader_->position.state != impl::reader::parse_state::after_tag_name) 
+				reader_->throw_invalid_read_call(method + " must immediately follow a start_element event"s);
+		}
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "xml_reader.hpp"
+#include <string_view>
+
+namespace mpd {
+	namespace xml {
+		enum class cursor_event { start_element, attribute, end_element, text, comment, processing_instruction, end_document, need_input };
+		const char* cursor_event_to_s(cursor_event event);
+
+		/**
+		A pull interface over a document_reader, as an alternative to passing in parser objects.
+		Each call to next() reads one event, so the caller may stop early, skip elements, or hand an
+		element to a parser object with read_child, without a parser type for every level.
+
+			mpd::xml::cursor cursor(document);
+			while (cursor.next() != mpd::xml::cursor_event::end_document) {
+				if (cursor.event() == mpd::xml::cursor_event::start_element && cursor.name() == "header") { ... break; }
+			}
+
+		Views from name() and value() are only valid until the next call to next().
+		Attribute events come immediately after their start_element event. An empty element (<a/>)
+		has both a start_element and an end_element event.
+		**/
+		class cursor {
+		public:
+			explicit cursor(document_reader& document);
+			cursor(const cursor&) = delete;
+			cursor& operator=(const cursor&) = delete;
+
+			// Reads the next event. After end_document, it keeps returning end_document.
+			// A push_reader returns need_input when it has read everything fed so far, and may be fed and resumed.
+			cursor_event next();
+			cursor_event event() const { return event_; }
+			// The element name for start_element and end_element, or the attribute name for attribute. Empty otherwise.
+			std::string_view name() const;
+			// As name(), but the interned id, or no_symbol.
+			symbol_id name_id() const;
+			// The interned URI of name()'s namespace, or no_symbol if it has none. Requires document_reader#enable_namespaces.
+			symbol_id namespace_id() const;
+			// As name_id(), but without the prefix.
+			symbol_id local_name_id() const;
+			// The attribute value, or the text, comment or processing instruction content. Empty otherwise.
+			std::string_view value() const;
+			// The number of open elements around the current event. The root element's events are at depth 0.
+			std::size_t depth() const;
+			// After a start_element or attribute event, reads the next attribute if there is one, and returns true with an attribute event.
+			// Otherwise returns false without reading on, so the caller may still look at the attributes and then skip_element.
+			bool next_attribute();
+			// After a start_element or attribute event, skips the rest of that element without tokenizing it. The event becomes its end_element.
+			void skip_element();
+			// Right after a start_element event, parses the element with a child_parser_t, as element_reader#read_child does.
+			// The element's end_element event is consumed too.
+			template<class child_parser_t>
+			typename std::remove_reference_t<child_parser_t>::element_type read_child(child_parser_t&& parser);
+			// For throwing exceptions with the current location, and for helpers that take a base_reader.
+			base_reader& reader();
+		protected:
+			explicit cursor(impl::reader& reader);
+		private:
+			void require_start_element(const char* method);
+			impl::reader* reader_;
+			cursor_event event_ = cursor_event::end_document;
+			bool finished_ = false;
+		};
+
+		template<class child_parser_t>
+		typename std::remove_reference_t<child_parser_t>::element_type cursor::read_child(child_parser_t&& parser) {
+			require_start_element("read_child");
+			typename std::remove_reference_t<child_parser_t>::element_type result = reader_->call_parse_tag(parser);
+			event_ = cursor_event::end_element;
+			return result;
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#include "xml_dom.hpp"
+#include "xml_cursor.hpp"
+
+namespace mpd {
+	namespace xml {
+		flat_document::flat_document(document_reader& document, bool keep_whitespace)
+			: symbols_(document.symbols())
+		{
+			struct open_element {
+				node_id node;
+				node_id last_attribute;
+				node_id last_child;
+			};
+			std::vector<open_element> open;
+			cursor cursor(document);
+			auto add_child = [this, &open](node_kind kind, symbol_id name, std::string_view value) {
+				open_element& parent = open.back();
+				node_id node = add_node(kind, parent.node, name, value);
+				if (parent.last_child == no_node) first_children_[parent.node] = node;
+				else next_siblings_[parent.last_child] = node;
+				parent.last_child = node;
+				return node;
+			};
+			for (cursor_event event; (event = cursor.next()) != cursor_event::end_document; ) {
+				switch (event) {
+				case cursor_event::start_element:
+					if (open.empty()) {
+						if (!kinds_.empty()) cursor.reader().throw_unexpected("unexpected root element " + std::string(cursor.name()));
+						open.push_back({ add_node(node_kind::element, no_node, cursor.name_id(), {}), no_node, no_node });
+					}
+					else {
+						node_id node = add_child(node_kind::element, cursor.name_id(), {});
+						open.push_back({ node, no_node, no_node });
+					}
+					break;
+				case cursor_event::attribute: {
+					open_element& element = open.back();
+					node_id node = add_node(node_kind::attribute, element.node, cursor.name_id(), cursor.value());
+					if (element.last_attribute != no_node) next_siblings_[element.last_attribute] = node;
+					element.last_attribute = node;
+					break;
+				}
+				case cursor_event::end_element:
+					open.pop_back();
+					break;
+				case cursor_event::text: {
+					std::string_view text = cursor.value();
+					if (open.empty()) {
+						if (!mpd::trim(text).empty()) cursor.reader().throw_unexpected(); //as document_root_parser does
+						break;
+					}
+					node_id last = open.back().last_child;
+					if (last != no_node && last + 1 == size() && kinds_[last] == node_kind::text) { //continues the previous text
+						arena_.append(text.data(), text.size());
+						value_lengths_[last] += static_cast<std::uint32_t>(text.size());
+					}
+					else if (keep_whitespace || !mpd::trim(text).empty())
+						add_child(node_kind::text, no_symbol, text);
+					break;
+				}
+				case cursor_event::comment:
+					if (!open.empty()) add_child(node_kind::comment, no_symbol, cursor.value());
+					break;
+				case cursor_event::processing_instruction:
+					if (!open.empty()) add_child(node_kind::processing_instruction, no_symbol, cursor.value());
+					break;
+				default:
+					break;
+				}
+			}
+			if (kinds_.empty()) cursor.reader().throw_missing(node_type::element_node, "root");
+		}
+
+		flat_document::node_id flat_document::add_node(node_kind kind, node_id parent, symbol_id name, std::string_view value) {
+			node_id node = static_cast<node_id>(kinds_.size());
+			kinds_.push_back(kind);
+			parents_.push_back(parent);
+			first_children_.push_back(no_node);
+			next_siblings_.push_back(no_node);
+			names_.push_back(name);
+			value_offsets_.push_back(arena_.size());
+			value_lengths_.push_back(static_cast<std::uint32_t>(value.size()));
+			arena_.append(value.data(), value.size());
+			return node;
+		}
+
+		std::string_view flat_document::name(node_id node) const {
+			return names_[node] == no_symbol ? std::string_view() : std::string_view(symbols_->name(names_[node]));
+		}
+		flat_document::node_id flat_document::child(node_id node, symbol_id name) const {
+			if (name == no_symbol) return no_node;
+			for (node_id child = first_child(node); child != no_node; child = next_sibling(child))
+				if (names_[child] == name && kinds_[child] == node_kind::element) return child;
+			return no_node;
+		}
+		flat_document::node_id flat_document::attribute(node_id node, symbol_id name) const {
+			if (name == no_symbol) return no_node;
+			for (node_id attribute = first_attribute(node); attribute != no_node; attribute = next_sibling(attribute))
+				if (names_[attribute] == name) return attribute;
+			return no_node;
+		}
+		std::string_view flat_document::attribute_value(node_id node, std::string_view name) const {
+			node_id found = attribute(node, name);
+			return found == no_node ? std::string_view() : value(found);
+		}
+		std::unordered_map<std::string_view, flat_document::node_id> flat_document::index_by_attribute(std::string_view name) const {
+			std::unordered_map<std::string_view, node_id> index;
+			symbol_id id = symbols_->find(name);
+			if (id == no_symbol) return index;
+			for (node_id node = 0; node < size(); ++node)
+				if (kinds_[node] == node_kind::attribute && names_[node] == id)
+					index.emplace(value(node), parents_[node]);
+			return index;
+		}
+	}
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "xml_reader.hpp"
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		/**
+		The whole document as a tree for random access, for consumers that look up, revisit or navigate nodes
+		rather than parse them into their own types. It's built in one pass over a document_reader, and stored as
+		parallel arrays indexed by node_id, so there is no allocation per node, and navigation touches little memory.
+		Names are the reader's interned symbol_ids, and all text and attribute values are in one arena.
+
+			mpd::xml::flat_document tree(document);
+			for (mpd::xml::flat_document::node_id child : tree.children(tree.root()))
+				if (tree.name(child) == "item") std::cout << tree.attribute_value(child, "id") << '\n';
+
+		A node's attributes come right after it, in document order, and are reached with attributes(), not children().
+		Adjacent text (such as around a CDATA section) is one text node. Whitespace only text is dropped unless
+		keep_whitespace is set, and comments and processing instructions outside the root element are not kept.
+		**/
+		class flat_document {
+		public:
+			using node_id = std::uint32_t;
+			static constexpr node_id no_node = UINT32_MAX;
+			enum class node_kind : std::uint8_t { element, attribute, text, comment, processing_instruction };
+
+			// Iterates a chain of siblings.
+			class sibling_range {
+				const flat_document* document_;
+				node_id first_;
+			public:
+				class iterator {
+					const flat_document* document_;
+					node_id node_;
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = node_id;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const node_id*;
+					using reference = node_id;
+					iterator(const flat_document* document, node_id node) : document_(document), node_(node) {}
+					node_id operator*() const { return node_; }
+					iterator& operator++() { node_ = document_->next_sibling(node_); return *this; }
+					iterator operator++(int) { iterator copy = *this; ++*this; return copy; }
+					bool operator==(const iterator& other) const { return node_ == other.node_; }
+					bool operator!=(const iterator& other) const { return node_ != other.node_; }
+				};
+				sibling_range(const flat_document* document, node_id first) : document_(document), first_(first) {}
+				iterator begin() const { return iterator(document_, first_); }
+				iterator end() const { return iterator(document_, no_node); }
+			};
+
+			// Reads the rest of the document. Throws as document_reader does if it's malformed.
+			explicit flat_document(document_reader& document, bool keep_whitespace = false);
+
+			// The root element.
+			node_id root() const { return 0; }
+			std::size_t size() const { return kinds_.size(); }
+			node_kind kind(node_id node) const { return kinds_[node]; }
+			// The parent element, or no_node for the root.
+			node_id parent(node_id node) const { return parents_[node]; }
+			// The first child that is not an attribute, or no_node.
+			node_id first_child(node_id node) const { return first_children_[node]; }
+			node_id next_sibling(node_id node) const { return next_siblings_[node]; }
+			node_id first_attribute(node_id node) const
+			{ return kinds_[node] == node_kind::element && node + 1 < size() && kinds_[node + 1] == node_kind::attribute ? node + 1 : no_node; }
+			sibling_range children(node_id node) const { return sibling_range(this, first_child(node)); }
+			sibling_range attributes(node_id node) const { return sibling_range(this, first_attribute(node)); }
+
+			// The element or attribute name's id, or no_symbol for other kinds.
+			symbol_id name_id(node_id node) const { return names_[node]; }
+			// The element or attribute name, or empty for other kinds.
+			std::string_view name(node_id node) const;
+			// The attribute value, or the text, comment or processing instruction content. Empty for elements.
+			std::string_view value(node_id node) const { return std::string_view(arena_.data() + value_offsets_[node], value_lengths_[node]); }
+
+			// The first child element with the name, or no_node.
+			node_id child(node_id node, symbol_id name) const;
+			node_id child(node_id node, std::string_view name) const { return child(node, symbols_->find(name)); }
+			// The element's attribute with the name, or no_node.
+			node_id attribute(node_id node, symbol_id name) const;
+			node_id attribute(node_id node, std::string_view name) const { return attribute(node, symbols_->find(name)); }
+			// The value of the element's attribute with the name, or empty if there isn't one.
+			std::string_view attribute_value(node_id node, std::string_view name) const;
+			// Maps each value of the attribute, such as "id", to the element that has it, for repeated lookups.
+			// If several elements have the same value, the first in document order is kept. The views are into this document.
+			std::unordered_map<std::string_view, node_id> index_by_attribute(std::string_view name) const;
+
+			const symbol_table& symbols() const { return *symbols_; }
+		private:
+			node_id add_node(node_kind kind, node_id parent, symbol_id name, std::string_view value);
+
+			std::vector<node_kind> kinds_;
+			std::vector<node_id> parents_;
+			std::vector<node_id> first_children_;
+			std::vector<node_id> next_siblings_;
+			std::vector<symbol_id> names_;
+			std::vector<std::size_t> value_offsets_;
+			std::vector<std::uint32_t> value_lengths_;
+			std::string arena_;
+			std::shared_ptr<symbol_table> symbols_;
+		};
+	}
+}
@@ -0,0 +1,94 @@
+#include "xml_dtd.hpp"
+#include "xml_entities.hpp"
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			void document_type::declare_entity(symbol_id name, std::string&& value, bool external) {
+				if (name >= entities_.size()) entities_.resize(name + 1);
+				entity& declared = entities_[name];
+				if (declared.declared) return;
+				declared.value = std::move(value);
+				declared.declared = true;
+				declared.external = external;
+				++entity_count_;
+			}
+			void document_type::declare_attribute_default(symbol_id element, symbol_id attribute, std::string&& value) {
+				if (element >= attribute_defaults_.size()) attribute_defaults_.resize(element + 1);
+				std::vector<attribute_default>& defaults = attribute_defaults_[element];
+				for (const attribute_default& existing : defaults)
+					if (existing.attribute == attribute) return;
+				defaults.push_back({ attribute, std::move(value) });
+			}
+
+			bool document_type::charge(std::size_t bytes, std::string& error) {
+				if (bytes > max_bytes_ - expanded_bytes_) {
+					error = "entity expansion exceeded the limit of " + std::to_string(max_bytes_) + " bytes";
+					return false;
+				}
+				expanded_bytes_ += bytes;
+				return true;
+			}
+			bool document_type::expand(symbol_id name, std::string& out, const symbol_table& symbols, std::string& error) {
+				const std::string* text = expansion(name, 0, symbols, error);
+				if (text == nullptr || !charge(text->size(), error)) return false;
+				out += *text;
+				return true;
+			}
+			bool document_type::expand_references(std::string& text, const symbol_table& symbols, std::string& error) {
+				if (text.find('&') == std::string::npos) return true;
+				std::string expanded;
+				if (!append_references(text, expanded, 0, symbols, error)) return false;
+				text = std::move(expanded);
+				return true;
+			}
+
+			const std::string* document_type::expansion(symbol_id name, std::size_t depth, const symbol_table& symbols, std::string& error) {
+				if (name >= entities_.size() || !entities_[name].declared) return nullptr;
+				entity& used = entities_[name];
+				if (used.expanded) return &used.expansion;
+				const std::string& entity_name = symbols.name(name);
+				if (used.external) error = "external entity &" + entity_name + "; isn't loaded";
+				else if (used.expanding) error = "entity &" + entity_name + "; references itself";
+				else if (depth == max_depth_) error = "entities are nested deeper than the limit of " + std::to_string(max_depth_);
+				else if (used.value.find('<') != std::string::npos) error = "entity &" + entity_name + "; contains markup, which isn't supported";
+				if (!error.empty()) return nullptr;
+				used.expanding = true;
+				std::string expanded;
+				bool ok = append_references(used.value, expanded, depth, symbols, error) && charge(expanded.size(), error);
+				used.expanding = false;
+				if (!ok) return nullptr;
+				used.expansion = std::move(expanded);
+				used.expanded = true;
+				return &used.expansion;
+			}
+			bool document_type::append_references(std::string_view text, std::string& out, std::size_t depth, const symbol_table& symbols, std::string& error) {
+				for (std::size_t idx = 0; idx < text.size(); ) {
+					std::size_t ampersand = text.find('&', idx);
+					out.append(text.substr(idx, ampersand - idx));
+					if (ampersand == std::string_view::npos) break;
+					std::size_t semicolon = text.find(';', ampersand);
+					if (semicolon == std::string_view::npos) {
+						error = "& without a ; in an entity";
+						return false;
+					}
+					std::string_view reference = text.substr(ampersand + 1, semicolon - ampersand - 1);
+					idx = semicolon + 1;
+					const std::string* nested = nullptr;
+					if (!reference.empty() && reference[0] != '#') {
+						symbol_id id = symbols.find(reference);
+						if (id != no_symbol) nested = expansion(id, depth + 1, symbols, error);
+						if (!error.empty()) return false;
+					}
+					if (nested != nullptr) out += *nested;
+					else if (!decode_entity(reference, out)) {
+						error = "&" + std::string(reference) + "; is not a declared entity or a recognized escape sequence";
+						return false;
+					}
+					if (out.size() > max_bytes_ - expanded_bytes_) return charge(out.size(), error); //fails before building the whole thing
+				}
+				return true;
+			}
+		}
+	}
+}
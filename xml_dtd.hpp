@@ -0,0 +1,68 @@
+#pragma once
+#include "xml_symbols.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			static constexpr std::size_t default_max_entity_depth = 16;
+			static constexpr std::uint64_t default_max_entity_bytes = 16 * 1024 * 1024;
+
+			/**
+			What a document's internal DTD subset declares that changes its content: general entities, and attribute defaults.
+			Both are compiled into arrays indexed by symbol_id when the DOCTYPE is read. An entity's replacement text is expanded
+			(including the entities it references) the first time it's used, and the expansion is cached for later uses.
+			Expansion is bounded both in nesting depth, and in the total bytes it produces across the document, counting
+			each cached expansion once and each use again, so that entities that reference each other many times over
+			(as in the "billion laughs" attack) fail quickly rather than exhausting memory.
+			External entities are never loaded, and entities whose replacement text contains markup aren't supported.
+			**/
+			class document_type {
+			public:
+				struct attribute_default {
+					symbol_id attribute;
+					std::string value;
+				};
+				bool has_entities() const { return entity_count_ != 0; }
+				bool has_attribute_defaults() const { return !attribute_defaults_.empty(); }
+				void limit_expansion(std::size_t max_depth, std::uint64_t max_bytes) { max_depth_ = max_depth; max_bytes_ = max_bytes; }
+				// The first declaration of an entity or attribute default is binding, and later ones are ignored.
+				void declare_entity(symbol_id name, std::string&& value, bool external);
+				void declare_attribute_default(symbol_id element, symbol_id attribute, std::string&& value);
+				// The declared defaults for the element's attributes, which may be empty.
+				const std::vector<attribute_default>& attribute_defaults(symbol_id element) const {
+					return element < attribute_defaults_.size() ? attribute_defaults_[element] : no_defaults_;
+				}
+				// Appends the expansion of the entity to out, and returns true. Returns false if it's not declared,
+				// or false with error set if it can't be expanded.
+				bool expand(symbol_id name, std::string& out, const symbol_table& symbols, std::string& error);
+				// Decodes the character and entity references in an attribute default. Returns false with error set if one can't be.
+				bool expand_references(std::string& text, const symbol_table& symbols, std::string& error);
+			private:
+				struct entity {
+					std::string value; //with character references decoded, and entity references still to be expanded
+					std::string expansion;
+					bool declared = false;
+					bool external = false;
+					bool expanded = false;
+					bool expanding = false;
+				};
+				const std::string* expansion(symbol_id name, std::size_t depth, const symbol_table& symbols, std::string& error);
+				bool append_references(std::string_view text, std::string& out, std::size_t depth, const symbol_table& symbols, std::string& error);
+				bool charge(std::size_t bytes, std::string& error);
+
+				std::vector<entity> entities_; //indexed by symbol_id
+				std::size_t entity_count_ = 0;
+				std::vector<std::vector<attribute_default>> attribute_defaults_; //indexed by element symbol_id
+				std::vector<attribute_default> no_defaults_;
+				std::size_t max_depth_ = default_max_entity_depth;
+				std::uint64_t max_bytes_ = default_max_entity_bytes;
+				std::uint64_t expanded_bytes_ = 0;
+			};
+		}
+	}
+}
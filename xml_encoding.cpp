@@ -0,0 +1,173 @@
+#include "xml_encoding.hpp"
+#include "xml_reader.hpp"
+#include "xml_scan.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			static constexpr std::size_t transcode_chunk_size = 16 * 1024;
+			static constexpr char32_t replacement_character = 0xFFFD;
+			// windows-1252 differs from ISO-8859-1 only in 0x80-0x9F. The five undefined bytes map to the same code point, as in browsers.
+			static constexpr char16_t windows1252_high[32] = {
+				0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+				0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+			};
+
+			encoding encoding_from_name(std::string_view name, encoding fallback) {
+				std::string lower(name);
+				std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c); });
+				if (lower == "utf-8" || lower == "utf8" || lower == "us-ascii" || lower == "ascii") return encoding::utf8;
+				if (lower == "iso-8859-1" || lower == "iso_8859-1" || lower == "iso8859-1" || lower == "latin1" || lower == "latin-1" || lower == "l1") return encoding::latin1;
+				if (lower == "windows-1252" || lower == "cp1252" || lower == "x-cp1252") return encoding::windows1252;
+				return fallback;
+			}
+			encoding detect_encoding(std::string_view prefix, std::size_t& bom_length) {
+				bom_length = 0;
+				if (prefix.substr(0, 3) == "\xEF\xBB\xBF") {
+					bom_length = 3;
+					return encoding::utf8;
+				}
+				if (prefix.substr(0, 2) == "\xFF\xFE") {
+					bom_length = 2;
+					return encoding::utf16le;
+				}
+				if (prefix.substr(0, 2) == "\xFE\xFF") {
+					bom_length = 2;
+					return encoding::utf16be;
+				}
+				if (prefix.substr(0, 4) == std::string_view("<\0?\0", 4)) return encoding::utf16le;
+				if (prefix.substr(0, 4) == std::string_view("\0<\0?", 4)) return encoding::utf16be;
+				// An ASCII compatible encoding, which the xml declaration names. UTF-16 can't be named by ASCII bytes, so it's ignored.
+				if (prefix.substr(0, 5) != "<?xml" || prefix.size() < 6 || !is_whitespace(prefix[5])) return encoding::utf8;
+				std::string_view declaration = prefix.substr(0, prefix.find("?>"));
+				std::size_t idx = declaration.find("encoding");
+				if (idx == std::string_view::npos) return encoding::utf8;
+				idx += 8;
+				while (idx < declaration.size() && is_whitespace(declaration[idx])) ++idx;
+				if (idx == declaration.size() || declaration[idx] != '=') return encoding::utf8;
+				++idx;
+				while (idx < declaration.size() && is_whitespace(declaration[idx])) ++idx;
+				if (idx == declaration.size() || (declaration[idx] != '"' && declaration[idx] != '\'')) return encoding::utf8;
+				std::size_t end = declaration.find(declaration[idx], idx + 1);
+				if (end == std::string_view::npos) return encoding::utf8;
+				return encoding_from_name(declaration.substr(idx + 1, end - idx - 1), encoding::utf8);
+			}
+
+			std::size_t transcoding_input::read(read_buf_t& source, char* out, std::size_t count) {
+				if (!detected_) {
+					staged_.resize(encoding_detect_size);
+					end_ = source.read(staged_.data(), staged_.size());
+					encoding_ = detect_encoding(std::string_view(staged_.data(), end_), begin_);
+					if (encoding_ != encoding::utf8) staged_.resize(transcode_chunk_size);
+					detected_ = true;
+				}
+				std::size_t written = 0;
+				while (carry_begin_ < carry_end_ && written < count) out[written++] = carry_[carry_begin_++];
+				if (encoding_ == encoding::utf8) {
+					std::size_t copied = std::min(end_ - begin_, count - written);
+					std::memcpy(out + written, staged_.data() + begin_, copied);
+					begin_ += copied;
+					written += copied;
+					if (written < count) written += source.read(out + written, count - written);
+					return written;
+				}
+				while (written < count) {
+					written += convert(out + written, count - written);
+					if (written < count && !refill(source)) {
+						if (begin_ < end_) { //the source ends partway through a character
+							written += put_code_point(replacement_character, out + written, count - written);
+							begin_ = end_;
+						}
+						break;
+					}
+				}
+				return written;
+			}
+			bool transcoding_input::refill(read_buf_t& source) {
+				std::size_t kept = end_ - begin_;
+				std::memmove(staged_.data(), staged_.data() + begin_, kept);
+				std::size_t added = source.read(staged_.data() + kept, staged_.size() - kept);
+				begin_ = 0;
+				end_ = kept + added;
+				return added != 0;
+			}
+			std::size_t transcoding_input::put_code_point(char32_t code_point, char* out, std::size_t count) {
+				char encoded[4];
+				std::size_t length;
+				if (code_point < 0x80) {
+					encoded[0] = static_cast<char>(code_point);
+					length = 1;
+				} else if (code_point < 0x800) {
+					encoded[0] = static_cast<char>(0xC0 | (code_point >> 6));
+					encoded[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 2;
+				} else if (code_point < 0x10000) {
+					encoded[0] = static_cast<char>(0xE0 | (code_point >> 12));
+					encoded[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					encoded[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 3;
+				} else {
+					encoded[0] = static_cast<char>(0xF0 | (code_point >> 18));
+					encoded[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+					encoded[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					encoded[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 4;
+				}
+				std::size_t copied = std::min(length, count);
+				std::memcpy(out, encoded, copied);
+				std::memcpy(carry_, encoded + copied, length - copied);
+				carry_begin_ = 0;
+				carry_end_ = length - copied;
+				return copied;
+			}
+			// Converts from staged_ until out is full, or staged_ has no complete character left.
+			std::size_t transcoding_input::convert(char* out, std::size_t count) {
+				std::size_t written = 0;
+				if (encoding_ == encoding::latin1 || encoding_ == encoding::windows1252) {
+					while (written < count && begin_ < end_) {
+						std::size_t span = std::min(end_ - begin_, count - written);
+						std::size_t ascii = copy_ascii(staged_.data() + begin_, span, out + written);
+						begin_ += ascii;
+						written += ascii;
+						if (ascii == span) continue;
+						unsigned char byte = static_cast<unsigned char>(staged_[begin_++]);
+						char32_t code_point = encoding_ == encoding::windows1252 && byte < 0xA0 ? windows1252_high[byte - 0x80] : byte;
+						written += put_code_point(code_point, out + written, count - written);
+					}
+					return written;
+				}
+				const bool big_endian = encoding_ == encoding::utf16be;
+				auto unit_at = [&](std::size_t idx) {
+					unsigned char first = static_cast<unsigned char>(staged_[idx]);
+					unsigned char second = static_cast<unsigned char>(staged_[idx + 1]);
+					return static_cast<char32_t>(big_endian ? (first << 8 | second) : (second << 8 | first));
+				};
+				while (written < count && end_ - begin_ >= 2) {
+					std::size_t units = std::min((end_ - begin_) / 2, count - written);
+					std::size_t ascii = narrow_ascii_utf16(staged_.data() + begin_, units, big_endian, out + written);
+					begin_ += 2 * ascii;
+					written += ascii;
+					if (ascii == units) continue;
+					char32_t code_point = unit_at(begin_);
+					std::size_t consumed = 2;
+					if (code_point >= 0xD800 && code_point < 0xDC00) {
+						if (end_ - begin_ < 4) break; //the low surrogate is in the next chunk
+						char32_t low = unit_at(begin_ + 2);
+						if (low >= 0xDC00 && low < 0xE000) {
+							code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+							consumed = 4;
+						}
+						else code_point = replacement_character;
+					}
+					else if (code_point >= 0xDC00 && code_point < 0xE000) code_point = replacement_character;
+					begin_ += consumed;
+					written += put_code_point(code_point, out + written, count - written);
+				}
+				return written;
+			}
+		}
+	}
+}
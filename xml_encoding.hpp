@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		// The encodings a document may be in. Whichever it is, parsers only ever see UTF-8.
+		enum class encoding { utf8, utf16le, utf16be, latin1, windows1252 };
+
+		namespace impl {
+			struct read_buf_t;
+			static constexpr std::size_t encoding_detect_size = 512; //the bytes detect_encoding needs, enough for any sensible xml declaration
+
+			// The encoding of a document from its first bytes: a byte order mark, the first characters of a UTF-16 document,
+			// or the encoding in its xml declaration. Unknown encodings are read as UTF-8. bom_length is set to the mark's size.
+			encoding detect_encoding(std::string_view prefix, std::size_t& bom_length);
+			// Returns fallback for names other than UTF-8, ASCII, ISO-8859-1 and windows-1252, and their aliases.
+			encoding encoding_from_name(std::string_view name, encoding fallback);
+
+			/**
+			Converts a source to UTF-8 a chunk at a time, for transcoding_read_buf. The encoding is detected on the first read.
+			ASCII runs, which are most of the markup, are converted 16 or 32 bytes at a time, and other characters one at a time.
+			A character split across chunks is completed on the next read, and one whose UTF-8 doesn't fit in what's left of
+			the reader's buffer is carried over to the next read, so a read only returns 0 at the end of the source.
+			UTF-8 sources are passed through without copying, once the bytes read to detect the encoding are used.
+			**/
+			class transcoding_input {
+			public:
+				std::size_t read(read_buf_t& source, char* out, std::size_t count);
+				encoding detected() const { return encoding_; }
+			private:
+				bool refill(read_buf_t& source);
+				std::size_t convert(char* out, std::size_t count);
+				std::size_t put_code_point(char32_t code_point, char* out, std::size_t count);
+
+				std::vector<char> staged_; //source bytes that haven't been converted yet are [begin_, end_)
+				std::size_t begin_ = 0;
+				std::size_t end_ = 0;
+				bool detected_ = false;
+				encoding encoding_ = encoding::utf8;
+				char carry_[4]; //the rest of a character that didn't fit in the last read
+				std::size_t carry_begin_ = 0;
+				std::size_t carry_end_ = 0;
+			};
+		}
+	}
+}
@@ -0,0 +1,2383 @@
+#include "xml_entities.hpp"
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			struct named_entity {
+				std::string_view name;
+				std::string_view utf8;
+			};
+			// {name, UTF-8 replacement} for every WHATWG HTML5 named character reference that ends in ';', which includes the XML predefined entities.
+			// Generated from https://html.spec.whatwg.org/entities.json, along with the hash parameters below.
+			static constexpr named_entity named_entities[] = {
+				{"AElig", "\xC3\x86"},
+				{"AMP", "&"},
+				{"Aacute", "\xC3\x81"},
+				{"Abreve", "\xC4\x82"},
+				{"Acirc", "\xC3\x82"},
+				{"Acy", "\xD0\x90"},
+				{"Afr", "\xF0\x9D\x94\x84"},
+				{"Agrave", "\xC3\x80"},
+				{"Alpha", "\xCE\x91"},
+				{"Amacr", "\xC4\x80"},
+				{"And", "\xE2\xA9\x93"},
+				{"Aogon", "\xC4\x84"},
+				{"Aopf", "\xF0\x9D\x94\xB8"},
+				{"ApplyFunction", "\xE2\x81\xA1"},
+				{"Aring", "\xC3\x85"},
+				{"Ascr", "\xF0\x9D\x92\x9C"},
+				{"Assign", "\xE2\x89\x94"},
+				{"Atilde", "\xC3\x83"},
+				{"Auml", "\xC3\x84"},
+				{"Backslash", "\xE2\x88\x96"},
+				{"Barv", "\xE2\xAB\xA7"},
+				{"Barwed", "\xE2\x8C\x86"},
+				{"Bcy", "\xD0\x91"},
+				{"Because", "\xE2\x88\xB5"},
+				{"Bernoullis", "\xE2\x84\xAC"},
+				{"Beta", "\xCE\x92"},
+				{"Bfr", "\xF0\x9D\x94\x85"},
+				{"Bopf", "\xF0\x9D\x94\xB9"},
+				{"Breve", "\xCB\x98"},
+				{"Bscr", "\xE2\x84\xAC"},
+				{"Bumpeq", "\xE2\x89\x8E"},
+				{"CHcy", "\xD0\xA7"},
+				{"COPY", "\xC2\xA9"},
+				{"Cacute", "\xC4\x86"},
+				{"Cap", "\xE2\x8B\x92"},
+				{"CapitalDifferentialD", "\xE2\x85\x85"},
+				{"Cayleys", "\xE2\x84\xAD"},
+				{"Ccaron", "\xC4\x8C"},
+				{"Ccedil", "\xC3\x87"},
+				{"Ccirc", "\xC4\x88"},
+				{"Cconint", "\xE2\x88\xB0"},
+				{"Cdot", "\xC4\x8A"},
+				{"Cedilla", "\xC2\xB8"},
+				{"CenterDot", "\xC2\xB7"},
+				{"Cfr", "\xE2\x84\xAD"},
+				{"Chi", "\xCE\xA7"},
+				{"CircleDot", "\xE2\x8A\x99"},
+				{"CircleMinus", "\xE2\x8A\x96"},
+				{"CirclePlus", "\xE2\x8A\x95"},
+				{"CircleTimes", "\xE2\x8A\x97"},
+				{"ClockwiseContourIntegral", "\xE2\x88\xB2"},
+				{"CloseCurlyDoubleQuote", "\xE2\x80\x9D"},
+				{"CloseCurlyQuote", "\xE2\x80\x99"},
+				{"Colon", "\xE2\x88\xB7"},
+				{"Colone", "\xE2\xA9\xB4"},
+				{"Congruent", "\xE2\x89\xA1"},
+				{"Conint", "\xE2\x88\xAF"},
+				{"ContourIntegral", "\xE2\x88\xAE"},
+				{"Copf", "\xE2\x84\x82"},
+				{"Coproduct", "\xE2\x88\x90"},
+				{"CounterClockwiseContourIntegral", "\xE2\x88\xB3"},
+				{"Cross", "\xE2\xA8\xAF"},
+				{"Cscr", "\xF0\x9D\x92\x9E"},
+				{"Cup", "\xE2\x8B\x93"},
+				{"CupCap", "\xE2\x89\x8D"},
+				{"DD", "\xE2\x85\x85"},
+				{"DDotrahd", "\xE2\xA4\x91"},
+				{"DJcy", "\xD0\x82"},
+				{"DScy", "\xD0\x85"},
+				{"DZcy", "\xD0\x8F"},
+				{"Dagger", "\xE2\x80\xA1"},
+				{"Darr", "\xE2\x86\xA1"},
+				{"Dashv", "\xE2\xAB\xA4"},
+				{"Dcaron", "\xC4\x8E"},
+				{"Dcy", "\xD0\x94"},
+				{"Del", "\xE2\x88\x87"},
+				{"Delta", "\xCE\x94"},
+				{"Dfr", "\xF0\x9D\x94\x87"},
+				{"DiacriticalAcute", "\xC2\xB4"},
+				{"DiacriticalDot", "\xCB\x99"},
+				{"DiacriticalDoubleAcute", "\xCB\x9D"},
+				{"DiacriticalGrave", "`"},
+				{"DiacriticalTilde", "\xCB\x9C"},
+				{"Diamond", "\xE2\x8B\x84"},
+				{"DifferentialD", "\xE2\x85\x86"},
+				{"Dopf", "\xF0\x9D\x94\xBB"},
+				{"Dot", "\xC2\xA8"},
+				{"DotDot", "\xE2\x83\x9C"},
+				{"DotEqual", "\xE2\x89\x90"},
+				{"DoubleContourIntegral", "\xE2\x88\xAF"},
+				{"DoubleDot", "\xC2\xA8"},
+				{"DoubleDownArrow", "\xE2\x87\x93"},
+				{"DoubleLeftArrow", "\xE2\x87\x90"},
+				{"DoubleLeftRightArrow", "\xE2\x87\x94"},
+				{"DoubleLeftTee", "\xE2\xAB\xA4"},
+				{"DoubleLongLeftArrow", "\xE2\x9F\xB8"},
+				{"DoubleLongLeftRightArrow", "\xE2\x9F\xBA"},
+				{"DoubleLongRightArrow", "\xE2\x9F\xB9"},
+				{"DoubleRightArrow", "\xE2\x87\x92"},
+				{"DoubleRightTee", "\xE2\x8A\xA8"},
+				{"DoubleUpArrow", "\xE2\x87\x91"},
+				{"DoubleUpDownArrow", "\xE2\x87\x95"},
+				{"DoubleVerticalBar", "\xE2\x88\xA5"},
+				{"DownArrow", "\xE2\x86\x93"},
+				{"DownArrowBar", "\xE2\xA4\x93"},
+				{"DownArrowUpArrow", "\xE2\x87\xB5"},
+				{"DownBreve", "\xCC\x91"},
+				{"DownLeftRightVector", "\xE2\xA5\x90"},
+				{"DownLeftTeeVector", "\xE2\xA5\x9E"},
+				{"DownLeftVector", "\xE2\x86\xBD"},
+				{"DownLeftVectorBar", "\xE2\xA5\x96"},
+				{"DownRightTeeVector", "\xE2\xA5\x9F"},
+				{"DownRightVector", "\xE2\x87\x81"},
+				{"DownRightVectorBar", "\xE2\xA5\x97"},
+				{"DownTee", "\xE2\x8A\xA4"},
+				{"DownTeeArrow", "\xE2\x86\xA7"},
+				{"Downarrow", "\xE2\x87\x93"},
+				{"Dscr", "\xF0\x9D\x92\x9F"},
+				{"Dstrok", "\xC4\x90"},
+				{"ENG", "\xC5\x8A"},
+				{"ETH", "\xC3\x90"},
+				{"Eacute", "\xC3\x89"},
+				{"Ecaron", "\xC4\x9A"},
+				{"Ecirc", "\xC3\x8A"},
+				{"Ecy", "\xD0\xAD"},
+				{"Edot", "\xC4\x96"},
+				{"Efr", "\xF0\x9D\x94\x88"},
+				{"Egrave", "\xC3\x88"},
+				{"Element", "\xE2\x88\x88"},
+				{"Emacr", "\xC4\x92"},
+				{"EmptySmallSquare", "\xE2\x97\xBB"},
+				{"EmptyVerySmallSquare", "\xE2\x96\xAB"},
+				{"Eogon", "\xC4\x98"},
+				{"Eopf", "\xF0\x9D\x94\xBC"},
+				{"Epsilon", "\xCE\x95"},
+				{"Equal", "\xE2\xA9\xB5"},
+				{"EqualTilde", "\xE2\x89\x82"},
+				{"Equilibrium", "\xE2\x87\x8C"},
+				{"Escr", "\xE2\x84\xB0"},
+				{"Esim", "\xE2\xA9\xB3"},
+				{"Eta", "\xCE\x97"},
+				{"Euml", "\xC3\x8B"},
+				{"Exists", "\xE2\x88\x83"},
+				{"ExponentialE", "\xE2\x85\x87"},
+				{"Fcy", "\xD0\xA4"},
+				{"Ffr", "\xF0\x9D\x94\x89"},
+				{"FilledSmallSquare", "\xE2\x97\xBC"},
+				{"FilledVerySmallSquare", "\xE2\x96\xAA"},
+				{"Fopf", "\xF0\x9D\x94\xBD"},
+				{"ForAll", "\xE2\x88\x80"},
+				{"Fouriertrf", "\xE2\x84\xB1"},
+				{"Fscr", "\xE2\x84\xB1"},
+				{"GJcy", "\xD0\x83"},
+				{"GT", ">"},
+				{"Gamma", "\xCE\x93"},
+				{"Gammad", "\xCF\x9C"},
+				{"Gbreve", "\xC4\x9E"},
+				{"Gcedil", "\xC4\xA2"},
+				{"Gcirc", "\xC4\x9C"},
+				{"Gcy", "\xD0\x93"},
+				{"Gdot", "\xC4\xA0"},
+				{"Gfr", "\xF0\x9D\x94\x8A"},
+				{"Gg", "\xE2\x8B\x99"},
+				{"Gopf", "\xF0\x9D\x94\xBE"},
+				{"GreaterEqual", "\xE2\x89\xA5"},
+				{"GreaterEqualLess", "\xE2\x8B\x9B"},
+				{"GreaterFullEqual", "\xE2\x89\xA7"},
+				{"GreaterGreater", "\xE2\xAA\xA2"},
+				{"GreaterLess", "\xE2\x89\xB7"},
+				{"GreaterSlantEqual", "\xE2\xA9\xBE"},
+				{"GreaterTilde", "\xE2\x89\xB3"},
+				{"Gscr", "\xF0\x9D\x92\xA2"},
+				{"Gt", "\xE2\x89\xAB"},
+				{"HARDcy", "\xD0\xAA"},
+				{"Hacek", "\xCB\x87"},
+				{"Hat", "^"},
+				{"Hcirc", "\xC4\xA4"},
+				{"Hfr", "\xE2\x84\x8C"},
+				{"HilbertSpace", "\xE2\x84\x8B"},
+				{"Hopf", "\xE2\x84\x8D"},
+				{"HorizontalLine", "\xE2\x94\x80"},
+				{"Hscr", "\xE2\x84\x8B"},
+				{"Hstrok", "\xC4\xA6"},
+				{"HumpDownHump", "\xE2\x89\x8E"},
+				{"HumpEqual", "\xE2\x89\x8F"},
+				{"IEcy", "\xD0\x95"},
+				{"IJlig", "\xC4\xB2"},
+				{"IOcy", "\xD0\x81"},
+				{"Iacute", "\xC3\x8D"},
+				{"Icirc", "\xC3\x8E"},
+				{"Icy", "\xD0\x98"},
+				{"Idot", "\xC4\xB0"},
+				{"Ifr", "\xE2\x84\x91"},
+				{"Igrave", "\xC3\x8C"},
+				{"Im", "\xE2\x84\x91"},
+				{"Imacr", "\xC4\xAA"},
+				{"ImaginaryI", "\xE2\x85\x88"},
+				{"Implies", "\xE2\x87\x92"},
+				{"Int", "\xE2\x88\xAC"},
+				{"Integral", "\xE2\x88\xAB"},
+				{"Intersection", "\xE2\x8B\x82"},
+				{"InvisibleComma", "\xE2\x81\xA3"},
+				{"InvisibleTimes", "\xE2\x81\xA2"},
+				{"Iogon", "\xC4\xAE"},
+				{"Iopf", "\xF0\x9D\x95\x80"},
+				{"Iota", "\xCE\x99"},
+				{"Iscr", "\xE2\x84\x90"},
+				{"Itilde", "\xC4\xA8"},
+				{"Iukcy", "\xD0\x86"},
+				{"Iuml", "\xC3\x8F"},
+				{"Jcirc", "\xC4\xB4"},
+				{"Jcy", "\xD0\x99"},
+				{"Jfr", "\xF0\x9D\x94\x8D"},
+				{"Jopf", "\xF0\x9D\x95\x81"},
+				{"Jscr", "\xF0\x9D\x92\xA5"},
+				{"Jsercy", "\xD0\x88"},
+				{"Jukcy", "\xD0\x84"},
+				{"KHcy", "\xD0\xA5"},
+				{"KJcy", "\xD0\x8C"},
+				{"Kappa", "\xCE\x9A"},
+				{"Kcedil", "\xC4\xB6"},
+				{"Kcy", "\xD0\x9A"},
+				{"Kfr", "\xF0\x9D\x94\x8E"},
+				{"Kopf", "\xF0\x9D\x95\x82"},
+				{"Kscr", "\xF0\x9D\x92\xA6"},
+				{"LJcy", "\xD0\x89"},
+				{"LT", "<"},
+				{"Lacute", "\xC4\xB9"},
+				{"Lambda", "\xCE\x9B"},
+				{"Lang", "\xE2\x9F\xAA"},
+				{"Laplacetrf", "\xE2\x84\x92"},
+				{"Larr", "\xE2\x86\x9E"},
+				{"Lcaron", "\xC4\xBD"},
+				{"Lcedil", "\xC4\xBB"},
+				{"Lcy", "\xD0\x9B"},
+				{"LeftAngleBracket", "\xE2\x9F\xA8"},
+				{"LeftArrow", "\xE2\x86\x90"},
+				{"LeftArrowBar", "\xE2\x87\xA4"},
+				{"LeftArrowRightArrow", "\xE2\x87\x86"},
+				{"LeftCeiling", "\xE2\x8C\x88"},
+				{"LeftDoubleBracket", "\xE2\x9F\xA6"},
+				{"LeftDownTeeVector", "\xE2\xA5\xA1"},
+				{"LeftDownVector", "\xE2\x87\x83"},
+				{"LeftDownVectorBar", "\xE2\xA5\x99"},
+				{"LeftFloor", "\xE2\x8C\x8A"},
+				{"LeftRightArrow", "\xE2\x86\x94"},
+				{"LeftRightVector", "\xE2\xA5\x8E"},
+				{"LeftTee", "\xE2\x8A\xA3"},
+				{"LeftTeeArrow", "\xE2\x86\xA4"},
+				{"LeftTeeVector", "\xE2\xA5\x9A"},
+				{"LeftTriangle", "\xE2\x8A\xB2"},
+				{"LeftTriangleBar", "\xE2\xA7\x8F"},
+				{"LeftTriangleEqual", "\xE2\x8A\xB4"},
+				{"LeftUpDownVector", "\xE2\xA5\x91"},
+				{"LeftUpTeeVector", "\xE2\xA5\xA0"},
+				{"LeftUpVector", "\xE2\x86\xBF"},
+				{"LeftUpVectorBar", "\xE2\xA5\x98"},
+				{"LeftVector", "\xE2\x86\xBC"},
+				{"LeftVectorBar", "\xE2\xA5\x92"},
+				{"Leftarrow", "\xE2\x87\x90"},
+				{"Leftrightarrow", "\xE2\x87\x94"},
+				{"LessEqualGreater", "\xE2\x8B\x9A"},
+				{"LessFullEqual", "\xE2\x89\xA6"},
+				{"LessGreater", "\xE2\x89\xB6"},
+				{"LessLess", "\xE2\xAA\xA1"},
+				{"LessSlantEqual", "\xE2\xA9\xBD"},
+				{"LessTilde", "\xE2\x89\xB2"},
+				{"Lfr", "\xF0\x9D\x94\x8F"},
+				{"Ll", "\xE2\x8B\x98"},
+				{"Lleftarrow", "\xE2\x87\x9A"},
+				{"Lmidot", "\xC4\xBF"},
+				{"LongLeftArrow", "\xE2\x9F\xB5"},
+				{"LongLeftRightArrow", "\xE2\x9F\xB7"},
+				{"LongRightArrow", "\xE2\x9F\xB6"},
+				{"Longleftarrow", "\xE2\x9F\xB8"},
+				{"Longleftrightarrow", "\xE2\x9F\xBA"},
+				{"Longrightarrow", "\xE2\x9F\xB9"},
+				{"Lopf", "\xF0\x9D\x95\x83"},
+				{"LowerLeftArrow", "\xE2\x86\x99"},
+				{"LowerRightArrow", "\xE2\x86\x98"},
+				{"Lscr", "\xE2\x84\x92"},
+				{"Lsh", "\xE2\x86\xB0"},
+				{"Lstrok", "\xC5\x81"},
+				{"Lt", "\xE2\x89\xAA"},
+				{"Map", "\xE2\xA4\x85"},
+				{"Mcy", "\xD0\x9C"},
+				{"MediumSpace", "\xE2\x81\x9F"},
+				{"Mellintrf", "\xE2\x84\xB3"},
+				{"Mfr", "\xF0\x9D\x94\x90"},
+				{"MinusPlus", "\xE2\x88\x93"},
+				{"Mopf", "\xF0\x9D\x95\x84"},
+				{"Mscr", "\xE2\x84\xB3"},
+				{"Mu", "\xCE\x9C"},
+				{"NJcy", "\xD0\x8A"},
+				{"Nacute", "\xC5\x83"},
+				{"Ncaron", "\xC5\x87"},
+				{"Ncedil", "\xC5\x85"},
+				{"Ncy", "\xD0\x9D"},
+				{"NegativeMediumSpace", "\xE2\x80\x8B"},
+				{"NegativeThickSpace", "\xE2\x80\x8B"},
+				{"NegativeThinSpace", "\xE2\x80\x8B"},
+				{"NegativeVeryThinSpace", "\xE2\x80\x8B"},
+				{"NestedGreaterGreater", "\xE2\x89\xAB"},
+				{"NestedLessLess", "\xE2\x89\xAA"},
+				{"NewLine", "\x0A"},
+				{"Nfr", "\xF0\x9D\x94\x91"},
+				{"NoBreak", "\xE2\x81\xA0"},
+				{"NonBreakingSpace", "\xC2\xA0"},
+				{"Nopf", "\xE2\x84\x95"},
+				{"Not", "\xE2\xAB\xAC"},
+				{"NotCongruent", "\xE2\x89\xA2"},
+				{"NotCupCap", "\xE2\x89\xAD"},
+				{"NotDoubleVerticalBar", "\xE2\x88\xA6"},
+				{"NotElement", "\xE2\x88\x89"},
+				{"NotEqual", "\xE2\x89\xA0"},
+				{"NotEqualTilde", "\xE2\x89\x82\xCC\xB8"},
+				{"NotExists", "\xE2\x88\x84"},
+				{"NotGreater", "\xE2\x89\xAF"},
+				{"NotGreaterEqual", "\xE2\x89\xB1"},
+				{"NotGreaterFullEqual", "\xE2\x89\xA7\xCC\xB8"},
+				{"NotGreaterGreater", "\xE2\x89\xAB\xCC\xB8"},
+				{"NotGreaterLess", "\xE2\x89\xB9"},
+				{"NotGreaterSlantEqual", "\xE2\xA9\xBE\xCC\xB8"},
+				{"NotGreaterTilde", "\xE2\x89\xB5"},
+				{"NotHumpDownHump", "\xE2\x89\x8E\xCC\xB8"},
+				{"NotHumpEqual", "\xE2\x89\x8F\xCC\xB8"},
+				{"NotLeftTriangle", "\xE2\x8B\xAA"},
+				{"NotLeftTriangleBar", "\xE2\xA7\x8F\xCC\xB8"},
+				{"NotLeftTriangleEqual", "\xE2\x8B\xAC"},
+				{"NotLess", "\xE2\x89\xAE"},
+				{"NotLessEqual", "\xE2\x89\xB0"},
+				{"NotLessGreater", "\xE2\x89\xB8"},
+				{"NotLessLess", "\xE2\x89\xAA\xCC\xB8"},
+				{"NotLessSlantEqual", "\xE2\xA9\xBD\xCC\xB8"},
+				{"NotLessTilde", "\xE2\x89\xB4"},
+				{"NotNestedGreaterGreater", "\xE2\xAA\xA2\xCC\xB8"},
+				{"NotNestedLessLess", "\xE2\xAA\xA1\xCC\xB8"},
+				{"NotPrecedes", "\xE2\x8A\x80"},
+				{"NotPrecedesEqual", "\xE2\xAA\xAF\xCC\xB8"},
+				{"NotPrecedesSlantEqual", "\xE2\x8B\xA0"},
+				{"NotReverseElement", "\xE2\x88\x8C"},
+				{"NotRightTriangle", "\xE2\x8B\xAB"},
+				{"NotRightTriangleBar", "\xE2\xA7\x90\xCC\xB8"},
+				{"NotRightTriangleEqual", "\xE2\x8B\xAD"},
+				{"NotSquareSubset", "\xE2\x8A\x8F\xCC\xB8"},
+				{"NotSquareSubsetEqual", "\xE2\x8B\xA2"},
+				{"NotSquareSuperset", "\xE2\x8A\x90\xCC\xB8"},
+				{"NotSquareSupersetEqual", "\xE2\x8B\xA3"},
+				{"NotSubset", "\xE2\x8A\x82\xE2\x83\x92"},
+				{"NotSubsetEqual", "\xE2\x8A\x88"},
+				{"NotSucceeds", "\xE2\x8A\x81"},
+				{"NotSucceedsEqual", "\xE2\xAA\xB0\xCC\xB8"},
+				{"NotSucceedsSlantEqual", "\xE2\x8B\xA1"},
+				{"NotSucceedsTilde", "\xE2\x89\xBF\xCC\xB8"},
+				{"NotSuperset", "\xE2\x8A\x83\xE2\x83\x92"},
+				{"NotSupersetEqual", "\xE2\x8A\x89"},
+				{"NotTilde", "\xE2\x89\x81"},
+				{"NotTildeEqual", "\xE2\x89\x84"},
+				{"NotTildeFullEqual", "\xE2\x89\x87"},
+				{"NotTildeTilde", "\xE2\x89\x89"},
+				{"NotVerticalBar", "\xE2\x88\xA4"},
+				{"Nscr", "\xF0\x9D\x92\xA9"},
+				{"Ntilde", "\xC3\x91"},
+				{"Nu", "\xCE\x9D"},
+				{"OElig", "\xC5\x92"},
+				{"Oacute", "\xC3\x93"},
+				{"Ocirc", "\xC3\x94"},
+				{"Ocy", "\xD0\x9E"},
+				{"Odblac", "\xC5\x90"},
+				{"Ofr", "\xF0\x9D\x94\x92"},
+				{"Ograve", "\xC3\x92"},
+				{"Omacr", "\xC5\x8C"},
+				{"Omega", "\xCE\xA9"},
+				{"Omicron", "\xCE\x9F"},
+				{"Oopf", "\xF0\x9D\x95\x86"},
+				{"OpenCurlyDoubleQuote", "\xE2\x80\x9C"},
+				{"OpenCurlyQuote", "\xE2\x80\x98"},
+				{"Or", "\xE2\xA9\x94"},
+				{"Oscr", "\xF0\x9D\x92\xAA"},
+				{"Oslash", "\xC3\x98"},
+				{"Otilde", "\xC3\x95"},
+				{"Otimes", "\xE2\xA8\xB7"},
+				{"Ouml", "\xC3\x96"},
+				{"OverBar", "\xE2\x80\xBE"},
+				{"OverBrace", "\xE2\x8F\x9E"},
+				{"OverBracket", "\xE2\x8E\xB4"},
+				{"OverParenthesis", "\xE2\x8F\x9C"},
+				{"PartialD", "\xE2\x88\x82"},
+				{"Pcy", "\xD0\x9F"},
+				{"Pfr", "\xF0\x9D\x94\x93"},
+				{"Phi", "\xCE\xA6"},
+				{"Pi", "\xCE\xA0"},
+				{"PlusMinus", "\xC2\xB1"},
+				{"Poincareplane", "\xE2\x84\x8C"},
+				{"Popf", "\xE2\x84\x99"},
+				{"Pr", "\xE2\xAA\xBB"},
+				{"Precedes", "\xE2\x89\xBA"},
+				{"PrecedesEqual", "\xE2\xAA\xAF"},
+				{"PrecedesSlantEqual", "\xE2\x89\xBC"},
+				{"PrecedesTilde", "\xE2\x89\xBE"},
+				{"Prime", "\xE2\x80\xB3"},
+				{"Product", "\xE2\x88\x8F"},
+				{"Proportion", "\xE2\x88\xB7"},
+				{"Proportional", "\xE2\x88\x9D"},
+				{"Pscr", "\xF0\x9D\x92\xAB"},
+				{"Psi", "\xCE\xA8"},
+				{"QUOT", "\x22"},
+				{"Qfr", "\xF0\x9D\x94\x94"},
+				{"Qopf", "\xE2\x84\x9A"},
+				{"Qscr", "\xF0\x9D\x92\xAC"},
+				{"RBarr", "\xE2\xA4\x90"},
+				{"REG", "\xC2\xAE"},
+				{"Racute", "\xC5\x94"},
+				{"Rang", "\xE2\x9F\xAB"},
+				{"Rarr", "\xE2\x86\xA0"},
+				{"Rarrtl", "\xE2\xA4\x96"},
+				{"Rcaron", "\xC5\x98"},
+				{"Rcedil", "\xC5\x96"},
+				{"Rcy", "\xD0\xA0"},
+				{"Re", "\xE2\x84\x9C"},
+				{"ReverseElement", "\xE2\x88\x8B"},
+				{"ReverseEquilibrium", "\xE2\x87\x8B"},
+				{"ReverseUpEquilibrium", "\xE2\xA5\xAF"},
+				{"Rfr", "\xE2\x84\x9C"},
+				{"Rho", "\xCE\xA1"},
+				{"RightAngleBracket", "\xE2\x9F\xA9"},
+				{"RightArrow", "\xE2\x86\x92"},
+				{"RightArrowBar", "\xE2\x87\xA5"},
+				{"RightArrowLeftArrow", "\xE2\x87\x84"},
+				{"RightCeiling", "\xE2\x8C\x89"},
+				{"RightDoubleBracket", "\xE2\x9F\xA7"},
+				{"RightDownTeeVector", "\xE2\xA5\x9D"},
+				{"RightDownVector", "\xE2\x87\x82"},
+				{"RightDownVectorBar", "\xE2\xA5\x95"},
+				{"RightFloor", "\xE2\x8C\x8B"},
+				{"RightTee", "\xE2\x8A\xA2"},
+				{"RightTeeArrow", "\xE2\x86\xA6"},
+				{"RightTeeVector", "\xE2\xA5\x9B"},
+				{"RightTriangle", "\xE2\x8A\xB3"},
+				{"RightTriangleBar", "\xE2\xA7\x90"},
+				{"RightTriangleEqual", "\xE2\x8A\xB5"},
+				{"RightUpDownVector", "\xE2\xA5\x8F"},
+				{"RightUpTeeVector", "\xE2\xA5\x9C"},
+				{"RightUpVector", "\xE2\x86\xBE"},
+				{"RightUpVectorBar", "\xE2\xA5\x94"},
+				{"RightVector", "\xE2\x87\x80"},
+				{"RightVectorBar", "\xE2\xA5\x93"},
+				{"Rightarrow", "\xE2\x87\x92"},
+				{"Ropf", "\xE2\x84\x9D"},
+				{"RoundImplies", "\xE2\xA5\xB0"},
+				{"Rrightarrow", "\xE2\x87\x9B"},
+				{"Rscr", "\xE2\x84\x9B"},
+				{"Rsh", "\xE2\x86\xB1"},
+				{"RuleDelayed", "\xE2\xA7\xB4"},
+				{"SHCHcy", "\xD0\xA9"},
+				{"SHcy", "\xD0\xA8"},
+				{"SOFTcy", "\xD0\xAC"},
+				{"Sacute", "\xC5\x9A"},
+				{"Sc", "\xE2\xAA\xBC"},
+				{"Scaron", "\xC5\xA0"},
+				{"Scedil", "\xC5\x9E"},
+				{"Scirc", "\xC5\x9C"},
+				{"Scy", "\xD0\xA1"},
+				{"Sfr", "\xF0\x9D\x94\x96"},
+				{"ShortDownArrow", "\xE2\x86\x93"},
+				{"ShortLeftArrow", "\xE2\x86\x90"},
+				{"ShortRightArrow", "\xE2\x86\x92"},
+				{"ShortUpArrow", "\xE2\x86\x91"},
+				{"Sigma", "\xCE\xA3"},
+				{"SmallCircle", "\xE2\x88\x98"},
+				{"Sopf", "\xF0\x9D\x95\x8A"},
+				{"Sqrt", "\xE2\x88\x9A"},
+				{"Square", "\xE2\x96\xA1"},
+				{"SquareIntersection", "\xE2\x8A\x93"},
+				{"SquareSubset", "\xE2\x8A\x8F"},
+				{"SquareSubsetEqual", "\xE2\x8A\x91"},
+				{"SquareSuperset", "\xE2\x8A\x90"},
+				{"SquareSupersetEqual", "\xE2\x8A\x92"},
+				{"SquareUnion", "\xE2\x8A\x94"},
+				{"Sscr", "\xF0\x9D\x92\xAE"},
+				{"Star", "\xE2\x8B\x86"},
+				{"Sub", "\xE2\x8B\x90"},
+				{"Subset", "\xE2\x8B\x90"},
+				{"SubsetEqual", "\xE2\x8A\x86"},
+				{"Succeeds", "\xE2\x89\xBB"},
+				{"SucceedsEqual", "\xE2\xAA\xB0"},
+				{"SucceedsSlantEqual", "\xE2\x89\xBD"},
+				{"SucceedsTilde", "\xE2\x89\xBF"},
+				{"SuchThat", "\xE2\x88\x8B"},
+				{"Sum", "\xE2\x88\x91"},
+				{"Sup", "\xE2\x8B\x91"},
+				{"Superset", "\xE2\x8A\x83"},
+				{"SupersetEqual", "\xE2\x8A\x87"},
+				{"Supset", "\xE2\x8B\x91"},
+				{"THORN", "\xC3\x9E"},
+				{"TRADE", "\xE2\x84\xA2"},
+				{"TSHcy", "\xD0\x8B"},
+				{"TScy", "\xD0\xA6"},
+				{"Tab", "\x09"},
+				{"Tau", "\xCE\xA4"},
+				{"Tcaron", "\xC5\xA4"},
+				{"Tcedil", "\xC5\xA2"},
+				{"Tcy", "\xD0\xA2"},
+				{"Tfr", "\xF0\x9D\x94\x97"},
+				{"Therefore", "\xE2\x88\xB4"},
+				{"Theta", "\xCE\x98"},
+				{"ThickSpace", "\xE2\x81\x9F\xE2\x80\x8A"},
+				{"ThinSpace", "\xE2\x80\x89"},
+				{"Tilde", "\xE2\x88\xBC"},
+				{"TildeEqual", "\xE2\x89\x83"},
+				{"TildeFullEqual", "\xE2\x89\x85"},
+				{"TildeTilde", "\xE2\x89\x88"},
+				{"Topf", "\xF0\x9D\x95\x8B"},
+				{"TripleDot", "\xE2\x83\x9B"},
+				{"Tscr", "\xF0\x9D\x92\xAF"},
+				{"Tstrok", "\xC5\xA6"},
+				{"Uacute", "\xC3\x9A"},
+				{"Uarr", "\xE2\x86\x9F"},
+				{"Uarrocir", "\xE2\xA5\x89"},
+				{"Ubrcy", "\xD0\x8E"},
+				{"Ubreve", "\xC5\xAC"},
+				{"Ucirc", "\xC3\x9B"},
+				{"Ucy", "\xD0\xA3"},
+				{"Udblac", "\xC5\xB0"},
+				{"Ufr", "\xF0\x9D\x94\x98"},
+				{"Ugrave", "\xC3\x99"},
+				{"Umacr", "\xC5\xAA"},
+				{"UnderBar", "_"},
+				{"UnderBrace", "\xE2\x8F\x9F"},
+				{"UnderBracket", "\xE2\x8E\xB5"},
+				{"UnderParenthesis", "\xE2\x8F\x9D"},
+				{"Union", "\xE2\x8B\x83"},
+				{"UnionPlus", "\xE2\x8A\x8E"},
+				{"Uogon", "\xC5\xB2"},
+				{"Uopf", "\xF0\x9D\x95\x8C"},
+				{"UpArrow", "\xE2\x86\x91"},
+				{"UpArrowBar", "\xE2\xA4\x92"},
+				{"UpArrowDownArrow", "\xE2\x87\x85"},
+				{"UpDownArrow", "\xE2\x86\x95"},
+				{"UpEquilibrium", "\xE2\xA5\xAE"},
+				{"UpTee", "\xE2\x8A\xA5"},
+				{"UpTeeArrow", "\xE2\x86\xA5"},
+				{"Uparrow", "\xE2\x87\x91"},
+				{"Updownarrow", "\xE2\x87\x95"},
+				{"UpperLeftArrow", "\xE2\x86\x96"},
+				{"UpperRightArrow", "\xE2\x86\x97"},
+				{"Upsi", "\xCF\x92"},
+				{"Upsilon", "\xCE\xA5"},
+				{"Uring", "\xC5\xAE"},
+				{"Uscr", "\xF0\x9D\x92\xB0"},
+				{"Utilde", "\xC5\xA8"},
+				{"Uuml", "\xC3\x9C"},
+				{"VDash", "\xE2\x8A\xAB"},
+				{"Vbar", "\xE2\xAB\xAB"},
+				{"Vcy", "\xD0\x92"},
+				{"Vdash", "\xE2\x8A\xA9"},
+				{"Vdashl", "\xE2\xAB\xA6"},
+				{"Vee", "\xE2\x8B\x81"},
+				{"Verbar", "\xE2\x80\x96"},
+				{"Vert", "\xE2\x80\x96"},
+				{"VerticalBar", "\xE2\x88\xA3"},
+				{"VerticalLine", "|"},
+				{"VerticalSeparator", "\xE2\x9D\x98"},
+				{"VerticalTilde", "\xE2\x89\x80"},
+				{"VeryThinSpace", "\xE2\x80\x8A"},
+				{"Vfr", "\xF0\x9D\x94\x99"},
+				{"Vopf", "\xF0\x9D\x95\x8D"},
+				{"Vscr", "\xF0\x9D\x92\xB1"},
+				{"Vvdash", "\xE2\x8A\xAA"},
+				{"Wcirc", "\xC5\xB4"},
+				{"Wedge", "\xE2\x8B\x80"},
+				{"Wfr", "\xF0\x9D\x94\x9A"},
+				{"Wopf", "\xF0\x9D\x95\x8E"},
+				{"Wscr", "\xF0\x9D\x92\xB2"},
+				{"Xfr", "\xF0\x9D\x94\x9B"},
+				{"Xi", "\xCE\x9E"},
+				{"Xopf", "\xF0\x9D\x95\x8F"},
+				{"Xscr", "\xF0\x9D\x92\xB3"},
+				{"YAcy", "\xD0\xAF"},
+				{"YIcy", "\xD0\x87"},
+				{"YUcy", "\xD0\xAE"},
+				{"Yacute", "\xC3\x9D"},
+				{"Ycirc", "\xC5\xB6"},
+				{"Ycy", "\xD0\xAB"},
+				{"Yfr", "\xF0\x9D\x94\x9C"},
+				{"Yopf", "\xF0\x9D\x95\x90"},
+				{"Yscr", "\xF0\x9D\x92\xB4"},
+				{"Yuml", "\xC5\xB8"},
+				{"ZHcy", "\xD0\x96"},
+				{"Zacute", "\xC5\xB9"},
+				{"Zcaron", "\xC5\xBD"},
+				{"Zcy", "\xD0\x97"},
+				{"Zdot", "\xC5\xBB"},
+				{"ZeroWidthSpace", "\xE2\x80\x8B"},
+				{"Zeta", "\xCE\x96"},
+				{"Zfr", "\xE2\x84\xA8"},
+				{"Zopf", "\xE2\x84\xA4"},
+				{"Zscr", "\xF0\x9D\x92\xB5"},
+				{"aacute", "\xC3\xA1"},
+				{"abreve", "\xC4\x83"},
+				{"ac", "\xE2\x88\xBE"},
+				{"acE", "\xE2\x88\xBE\xCC\xB3"},
+				{"acd", "\xE2\x88\xBF"},
+				{"acirc", "\xC3\xA2"},
+				{"acute", "\xC2\xB4"},
+				{"acy", "\xD0\xB0"},
+				{"aelig", "\xC3\xA6"},
+				{"af", "\xE2\x81\xA1"},
+				{"afr", "\xF0\x9D\x94\x9E"},
+				{"agrave", "\xC3\xA0"},
+				{"alefsym", "\xE2\x84\xB5"},
+				{"aleph", "\xE2\x84\xB5"},
+				{"alpha", "\xCE\xB1"},
+				{"amacr", "\xC4\x81"},
+				{"amalg", "\xE2\xA8\xBF"},
+				{"amp", "&"},
+				{"and", "\xE2\x88\xA7"},
+				{"andand", "\xE2\xA9\x95"},
+				{"andd", "\xE2\xA9\x9C"},
+				{"andslope", "\xE2\xA9\x98"},
+				{"andv", "\xE2\xA9\x9A"},
+				{"ang", "\xE2\x88\xA0"},
+				{"ange", "\xE2\xA6\xA4"},
+				{"angle", "\xE2\x88\xA0"},
+				{"angmsd", "\xE2\x88\xA1"},
+				{"angmsdaa", "\xE2\xA6\xA8"},
+				{"angmsdab", "\xE2\xA6\xA9"},
+				{"angmsdac", "\xE2\xA6\xAA"},
+				{"angmsdad", "\xE2\xA6\xAB"},
+				{"angmsdae", "\xE2\xA6\xAC"},
+				{"angmsdaf", "\xE2\xA6\xAD"},
+				{"angmsdag", "\xE2\xA6\xAE"},
+				{"angmsdah", "\xE2\xA6\xAF"},
+				{"angrt", "\xE2\x88\x9F"},
+				{"angrtvb", "\xE2\x8A\xBE"},
+				{"angrtvbd", "\xE2\xA6\x9D"},
+				{"angsph", "\xE2\x88\xA2"},
+				{"angst", "\xC3\x85"},
+				{"angzarr", "\xE2\x8D\xBC"},
+				{"aogon", "\xC4\x85"},
+				{"aopf", "\xF0\x9D\x95\x92"},
+				{"ap", "\xE2\x89\x88"},
+				{"apE", "\xE2\xA9\xB0"},
+				{"apacir", "\xE2\xA9\xAF"},
+				{"ape", "\xE2\x89\x8A"},
+				{"apid", "\xE2\x89\x8B"},
+				{"apos", "'"},
+				{"approx", "\xE2\x89\x88"},
+				{"approxeq", "\xE2\x89\x8A"},
+				{"aring", "\xC3\xA5"},
+				{"ascr", "\xF0\x9D\x92\xB6"},
+				{"ast", "*"},
+				{"asymp", "\xE2\x89\x88"},
+				{"asympeq", "\xE2\x89\x8D"},
+				{"atilde", "\xC3\xA3"},
+				{"auml", "\xC3\xA4"},
+				{"awconint", "\xE2\x88\xB3"},
+				{"awint", "\xE2\xA8\x91"},
+				{"bNot", "\xE2\xAB\xAD"},
+				{"backcong", "\xE2\x89\x8C"},
+				{"backepsilon", "\xCF\xB6"},
+				{"backprime", "\xE2\x80\xB5"},
+				{"backsim", "\xE2\x88\xBD"},
+				{"backsimeq", "\xE2\x8B\x8D"},
+				{"barvee", "\xE2\x8A\xBD"},
+				{"barwed", "\xE2\x8C\x85"},
+				{"barwedge", "\xE2\x8C\x85"},
+				{"bbrk", "\xE2\x8E\xB5"},
+				{"bbrktbrk", "\xE2\x8E\xB6"},
+				{"bcong", "\xE2\x89\x8C"},
+				{"bcy", "\xD0\xB1"},
+				{"bdquo", "\xE2\x80\x9E"},
+				{"becaus", "\xE2\x88\xB5"},
+				{"because", "\xE2\x88\xB5"},
+				{"bemptyv", "\xE2\xA6\xB0"},
+				{"bepsi", "\xCF\xB6"},
+				{"bernou", "\xE2\x84\xAC"},
+				{"beta", "\xCE\xB2"},
+				{"beth", "\xE2\x84\xB6"},
+				{"between", "\xE2\x89\xAC"},
+				{"bfr", "\xF0\x9D\x94\x9F"},
+				{"bigcap", "\xE2\x8B\x82"},
+				{"bigcirc", "\xE2\x97\xAF"},
+				{"bigcup", "\xE2\x8B\x83"},
+				{"bigodot", "\xE2\xA8\x80"},
+				{"bigoplus", "\xE2\xA8\x81"},
+				{"bigotimes", "\xE2\xA8\x82"},
+				{"bigsqcup", "\xE2\xA8\x86"},
+				{"bigstar", "\xE2\x98\x85"},
+				{"bigtriangledown", "\xE2\x96\xBD"},
+				{"bigtriangleup", "\xE2\x96\xB3"},
+				{"biguplus", "\xE2\xA8\x84"},
+				{"bigvee", "\xE2\x8B\x81"},
+				{"bigwedge", "\xE2\x8B\x80"},
+				{"bkarow", "\xE2\xA4\x8D"},
+				{"blacklozenge", "\xE2\xA7\xAB"},
+				{"blacksquare", "\xE2\x96\xAA"},
+				{"blacktriangle", "\xE2\x96\xB4"},
+				{"blacktriangledown", "\xE2\x96\xBE"},
+				{"blacktriangleleft", "\xE2\x97\x82"},
+				{"blacktriangleright", "\xE2\x96\xB8"},
+				{"blank", "\xE2\x90\xA3"},
+				{"blk12", "\xE2\x96\x92"},
+				{"blk14", "\xE2\x96\x91"},
+				{"blk34", "\xE2\x96\x93"},
+				{"block", "\xE2\x96\x88"},
+				{"bne", "=\xE2\x83\xA5"},
+				{"bnequiv", "\xE2\x89\xA1\xE2\x83\xA5"},
+				{"bnot", "\xE2\x8C\x90"},
+				{"bopf", "\xF0\x9D\x95\x93"},
+				{"bot", "\xE2\x8A\xA5"},
+				{"bottom", "\xE2\x8A\xA5"},
+				{"bowtie", "\xE2\x8B\x88"},
+				{"boxDL", "\xE2\x95\x97"},
+				{"boxDR", "\xE2\x95\x94"},
+				{"boxDl", "\xE2\x95\x96"},
+				{"boxDr", "\xE2\x95\x93"},
+				{"boxH", "\xE2\x95\x90"},
+				{"boxHD", "\xE2\x95\xA6"},
+				{"boxHU", "\xE2\x95\xA9"},
+				{"boxHd", "\xE2\x95\xA4"},
+				{"boxHu", "\xE2\x95\xA7"},
+				{"boxUL", "\xE2\x95\x9D"},
+				{"boxUR", "\xE2\x95\x9A"},
+				{"boxUl", "\xE2\x95\x9C"},
+				{"boxUr", "\xE2\x95\x99"},
+				{"boxV", "\xE2\x95\x91"},
+				{"boxVH", "\xE2\x95\xAC"},
+				{"boxVL", "\xE2\x95\xA3"},
+				{"boxVR", "\xE2\x95\xA0"},
+				{"boxVh", "\xE2\x95\xAB"},
+				{"boxVl", "\xE2\x95\xA2"},
+				{"boxVr", "\xE2\x95\x9F"},
+				{"boxbox", "\xE2\xA7\x89"},
+				{"boxdL", "\xE2\x95\x95"},
+				{"boxdR", "\xE2\x95\x92"},
+				{"boxdl", "\xE2\x94\x90"},
+				{"boxdr", "\xE2\x94\x8C"},
+				{"boxh", "\xE2\x94\x80"},
+				{"boxhD", "\xE2\x95\xA5"},
+				{"boxhU", "\xE2\x95\xA8"},
+				{"boxhd", "\xE2\x94\xAC"},
+				{"boxhu", "\xE2\x94\xB4"},
+				{"boxminus", "\xE2\x8A\x9F"},
+				{"boxplus", "\xE2\x8A\x9E"},
+				{"boxtimes", "\xE2\x8A\xA0"},
+				{"boxuL", "\xE2\x95\x9B"},
+				{"boxuR", "\xE2\x95\x98"},
+				{"boxul", "\xE2\x94\x98"},
+				{"boxur", "\xE2\x94\x94"},
+				{"boxv", "\xE2\x94\x82"},
+				{"boxvH", "\xE2\x95\xAA"},
+				{"boxvL", "\xE2\x95\xA1"},
+				{"boxvR", "\xE2\x95\x9E"},
+				{"boxvh", "\xE2\x94\xBC"},
+				{"boxvl", "\xE2\x94\xA4"},
+				{"boxvr", "\xE2\x94\x9C"},
+				{"bprime", "\xE2\x80\xB5"},
+				{"breve", "\xCB\x98"},
+				{"brvbar", "\xC2\xA6"},
+				{"bscr", "\xF0\x9D\x92\xB7"},
+				{"bsemi", "\xE2\x81\x8F"},
+				{"bsim", "\xE2\x88\xBD"},
+				{"bsime", "\xE2\x8B\x8D"},
+				{"bsol", "\x5C"},
+				{"bsolb", "\xE2\xA7\x85"},
+				{"bsolhsub", "\xE2\x9F\x88"},
+				{"bull", "\xE2\x80\xA2"},
+				{"bullet", "\xE2\x80\xA2"},
+				{"bump", "\xE2\x89\x8E"},
+				{"bumpE", "\xE2\xAA\xAE"},
+				{"bumpe", "\xE2\x89\x8F"},
+				{"bumpeq", "\xE2\x89\x8F"},
+				{"cacute", "\xC4\x87"},
+				{"cap", "\xE2\x88\xA9"},
+				{"capand", "\xE2\xA9\x84"},
+				{"capbrcup", "\xE2\xA9\x89"},
+				{"capcap", "\xE2\xA9\x8B"},
+				{"capcup", "\xE2\xA9\x87"},
+				{"capdot", "\xE2\xA9\x80"},
+				{"caps", "\xE2\x88\xA9\xEF\xB8\x80"},
+				{"caret", "\xE2\x81\x81"},
+				{"caron", "\xCB\x87"},
+				{"ccaps", "\xE2\xA9\x8D"},
+				{"ccaron", "\xC4\x8D"},
+				{"ccedil", "\xC3\xA7"},
+				{"ccirc", "\xC4\x89"},
+				{"ccups", "\xE2\xA9\x8C"},
+				{"ccupssm", "\xE2\xA9\x90"},
+				{"cdot", "\xC4\x8B"},
+				{"cedil", "\xC2\xB8"},
+				{"cemptyv", "\xE2\xA6\xB2"},
+				{"cent", "\xC2\xA2"},
+				{"centerdot", "\xC2\xB7"},
+				{"cfr", "\xF0\x9D\x94\xA0"},
+				{"chcy", "\xD1\x87"},
+				{"check", "\xE2\x9C\x93"},
+				{"checkmark", "\xE2\x9C\x93"},
+				{"chi", "\xCF\x87"},
+				{"cir", "\xE2\x97\x8B"},
+				{"cirE", "\xE2\xA7\x83"},
+				{"circ", "\xCB\x86"},
+				{"circeq", "\xE2\x89\x97"},
+				{"circlearrowleft", "\xE2\x86\xBA"},
+				{"circlearrowright", "\xE2\x86\xBB"},
+				{"circledR", "\xC2\xAE"},
+				{"circledS", "\xE2\x93\x88"},
+				{"circledast", "\xE2\x8A\x9B"},
+				{"circledcirc", "\xE2\x8A\x9A"},
+				{"circleddash", "\xE2\x8A\x9D"},
+				{"cire", "\xE2\x89\x97"},
+				{"cirfnint", "\xE2\xA8\x90"},
+				{"cirmid", "\xE2\xAB\xAF"},
+				{"cirscir", "\xE2\xA7\x82"},
+				{"clubs", "\xE2\x99\xA3"},
+				{"clubsuit", "\xE2\x99\xA3"},
+				{"colon", ":"},
+				{"colone", "\xE2\x89\x94"},
+				{"coloneq", "\xE2\x89\x94"},
+				{"comma", ","},
+				{"commat", "@"},
+				{"comp", "\xE2\x88\x81"},
+				{"compfn", "\xE2\x88\x98"},
+				{"complement", "\xE2\x88\x81"},
+				{"complexes", "\xE2\x84\x82"},
+				{"cong", "\xE2\x89\x85"},
+				{"congdot", "\xE2\xA9\xAD"},
+				{"conint", "\xE2\x88\xAE"},
+				{"copf", "\xF0\x9D\x95\x94"},
+				{"coprod", "\xE2\x88\x90"},
+				{"copy", "\xC2\xA9"},
+				{"copysr", "\xE2\x84\x97"},
+				{"crarr", "\xE2\x86\xB5"},
+				{"cross", "\xE2\x9C\x97"},
+				{"cscr", "\xF0\x9D\x92\xB8"},
+				{"csub", "\xE2\xAB\x8F"},
+				{"csube", "\xE2\xAB\x91"},
+				{"csup", "\xE2\xAB\x90"},
+				{"csupe", "\xE2\xAB\x92"},
+				{"ctdot", "\xE2\x8B\xAF"},
+				{"cudarrl", "\xE2\xA4\xB8"},
+				{"cudarrr", "\xE2\xA4\xB5"},
+				{"cuepr", "\xE2\x8B\x9E"},
+				{"cuesc", "\xE2\x8B\x9F"},
+				{"cularr", "\xE2\x86\xB6"},
+				{"cularrp", "\xE2\xA4\xBD"},
+				{"cup", "\xE2\x88\xAA"},
+				{"cupbrcap", "\xE2\xA9\x88"},
+				{"cupcap", "\xE2\xA9\x86"},
+				{"cupcup", "\xE2\xA9\x8A"},
+				{"cupdot", "\xE2\x8A\x8D"},
+				{"cupor", "\xE2\xA9\x85"},
+				{"cups", "\xE2\x88\xAA\xEF\xB8\x80"},
+				{"curarr", "\xE2\x86\xB7"},
+				{"curarrm", "\xE2\xA4\xBC"},
+				{"curlyeqprec", "\xE2\x8B\x9E"},
+				{"curlyeqsucc", "\xE2\x8B\x9F"},
+				{"curlyvee", "\xE2\x8B\x8E"},
+				{"curlywedge", "\xE2\x8B\x8F"},
+				{"curren", "\xC2\xA4"},
+				{"curvearrowleft", "\xE2\x86\xB6"},
+				{"curvearrowright", "\xE2\x86\xB7"},
+				{"cuvee", "\xE2\x8B\x8E"},
+				{"cuwed", "\xE2\x8B\x8F"},
+				{"cwconint", "\xE2\x88\xB2"},
+				{"cwint", "\xE2\x88\xB1"},
+				{"cylcty", "\xE2\x8C\xAD"},
+				{"dArr", "\xE2\x87\x93"},
+				{"dHar", "\xE2\xA5\xA5"},
+				{"dagger", "\xE2\x80\xA0"},
+				{"daleth", "\xE2\x84\xB8"},
+				{"darr", "\xE2\x86\x93"},
+				{"dash", "\xE2\x80\x90"},
+				{"dashv", "\xE2\x8A\xA3"},
+				{"dbkarow", "\xE2\xA4\x8F"},
+				{"dblac", "\xCB\x9D"},
+				{"dcaron", "\xC4\x8F"},
+				{"dcy", "\xD0\xB4"},
+				{"dd", "\xE2\x85\x86"},
+				{"ddagger", "\xE2\x80\xA1"},
+				{"ddarr", "\xE2\x87\x8A"},
+				{"ddotseq", "\xE2\xA9\xB7"},
+				{"deg", "\xC2\xB0"},
+				{"delta", "\xCE\xB4"},
+				{"demptyv", "\xE2\xA6\xB1"},
+				{"dfisht", "\xE2\xA5\xBF"},
+				{"dfr", "\xF0\x9D\x94\xA1"},
+				{"dharl", "\xE2\x87\x83"},
+				{"dharr", "\xE2\x87\x82"},
+				{"diam", "\xE2\x8B\x84"},
+				{"diamond", "\xE2\x8B\x84"},
+				{"diamondsuit", "\xE2\x99\xA6"},
+				{"diams", "\xE2\x99\xA6"},
+				{"die", "\xC2\xA8"},
+				{"digamma", "\xCF\x9D"},
+				{"disin", "\xE2\x8B\xB2"},
+				{"div", "\xC3\xB7"},
+				{"divide", "\xC3\xB7"},
+				{"divideontimes", "\xE2\x8B\x87"},
+				{"divonx", "\xE2\x8B\x87"},
+				{"djcy", "\xD1\x92"},
+				{"dlcorn", "\xE2\x8C\x9E"},
+				{"dlcrop", "\xE2\x8C\x8D"},
+				{"dollar", "$"},
+				{"dopf", "\xF0\x9D\x95\x95"},
+				{"dot", "\xCB\x99"},
+				{"doteq", "\xE2\x89\x90"},
+				{"doteqdot", "\xE2\x89\x91"},
+				{"dotminus", "\xE2\x88\xB8"},
+				{"dotplus", "\xE2\x88\x94"},
+				{"dotsquare", "\xE2\x8A\xA1"},
+				{"doublebarwedge", "\xE2\x8C\x86"},
+				{"downarrow", "\xE2\x86\x93"},
+				{"downdownarrows", "\xE2\x87\x8A"},
+				{"downharpoonleft", "\xE2\x87\x83"},
+				{"downharpoonright", "\xE2\x87\x82"},
+				{"drbkarow", "\xE2\xA4\x90"},
+				{"drcorn", "\xE2\x8C\x9F"},
+				{"drcrop", "\xE2\x8C\x8C"},
+				{"dscr", "\xF0\x9D\x92\xB9"},
+				{"dscy", "\xD1\x95"},
+				{"dsol", "\xE2\xA7\xB6"},
+				{"dstrok", "\xC4\x91"},
+				{"dtdot", "\xE2\x8B\xB1"},
+				{"dtri", "\xE2\x96\xBF"},
+				{"dtrif", "\xE2\x96\xBE"},
+				{"duarr", "\xE2\x87\xB5"},
+				{"duhar", "\xE2\xA5\xAF"},
+				{"dwangle", "\xE2\xA6\xA6"},
+				{"dzcy", "\xD1\x9F"},
+				{"dzigrarr", "\xE2\x9F\xBF"},
+				{"eDDot", "\xE2\xA9\xB7"},
+				{"eDot", "\xE2\x89\x91"},
+				{"eacute", "\xC3\xA9"},
+				{"easter", "\xE2\xA9\xAE"},
+				{"ecaron", "\xC4\x9B"},
+				{"ecir", "\xE2\x89\x96"},
+				{"ecirc", "\xC3\xAA"},
+				{"ecolon", "\xE2\x89\x95"},
+				{"ecy", "\xD1\x8D"},
+				{"edot", "\xC4\x97"},
+				{"ee", "\xE2\x85\x87"},
+				{"efDot", "\xE2\x89\x92"},
+				{"efr", "\xF0\x9D\x94\xA2"},
+				{"eg", "\xE2\xAA\x9A"},
+				{"egrave", "\xC3\xA8"},
+				{"egs", "\xE2\xAA\x96"},
+				{"egsdot", "\xE2\xAA\x98"},
+				{"el", "\xE2\xAA\x99"},
+				{"elinters", "\xE2\x8F\xA7"},
+				{"ell", "\xE2\x84\x93"},
+				{"els", "\xE2\xAA\x95"},
+				{"elsdot", "\xE2\xAA\x97"},
+				{"emacr", "\xC4\x93"},
+				{"empty", "\xE2\x88\x85"},
+				{"emptyset", "\xE2\x88\x85"},
+				{"emptyv", "\xE2\x88\x85"},
+				{"emsp", "\xE2\x80\x83"},
+				{"emsp13", "\xE2\x80\x84"},
+				{"emsp14", "\xE2\x80\x85"},
+				{"eng", "\xC5\x8B"},
+				{"ensp", "\xE2\x80\x82"},
+				{"eogon", "\xC4\x99"},
+				{"eopf", "\xF0\x9D\x95\x96"},
+				{"epar", "\xE2\x8B\x95"},
+				{"eparsl", "\xE2\xA7\xA3"},
+				{"eplus", "\xE2\xA9\xB1"},
+				{"epsi", "\xCE\xB5"},
+				{"epsilon", "\xCE\xB5"},
+				{"epsiv", "\xCF\xB5"},
+				{"eqcirc", "\xE2\x89\x96"},
+				{"eqcolon", "\xE2\x89\x95"},
+				{"eqsim", "\xE2\x89\x82"},
+				{"eqslantgtr", "\xE2\xAA\x96"},
+				{"eqslantless", "\xE2\xAA\x95"},
+				{"equals", "="},
+				{"equest", "\xE2\x89\x9F"},
+				{"equiv", "\xE2\x89\xA1"},
+				{"equivDD", "\xE2\xA9\xB8"},
+				{"eqvparsl", "\xE2\xA7\xA5"},
+				{"erDot", "\xE2\x89\x93"},
+				{"erarr", "\xE2\xA5\xB1"},
+				{"escr", "\xE2\x84\xAF"},
+				{"esdot", "\xE2\x89\x90"},
+				{"esim", "\xE2\x89\x82"},
+				{"eta", "\xCE\xB7"},
+				{"eth", "\xC3\xB0"},
+				{"euml", "\xC3\xAB"},
+				{"euro", "\xE2\x82\xAC"},
+				{"excl", "!"},
+				{"exist", "\xE2\x88\x83"},
+				{"expectation", "\xE2\x84\xB0"},
+				{"exponentiale", "\xE2\x85\x87"},
+				{"fallingdotseq", "\xE2\x89\x92"},
+				{"fcy", "\xD1\x84"},
+				{"female", "\xE2\x99\x80"},
+				{"ffilig", "\xEF\xAC\x83"},
+				{"fflig", "\xEF\xAC\x80"},
+				{"ffllig", "\xEF\xAC\x84"},
+				{"ffr", "\xF0\x9D\x94\xA3"},
+				{"filig", "\xEF\xAC\x81"},
+				{"fjlig", "fj"},
+				{"flat", "\xE2\x99\xAD"},
+				{"fllig", "\xEF\xAC\x82"},
+				{"fltns", "\xE2\x96\xB1"},
+				{"fnof", "\xC6\x92"},
+				{"fopf", "\xF0\x9D\x95\x97"},
+				{"forall", "\xE2\x88\x80"},
+				{"fork", "\xE2\x8B\x94"},
+				{"forkv", "\xE2\xAB\x99"},
+				{"fpartint", "\xE2\xA8\x8D"},
+				{"frac12", "\xC2\xBD"},
+				{"frac13", "\xE2\x85\x93"},
+				{"frac14", "\xC2\xBC"},
+				{"frac15", "\xE2\x85\x95"},
+				{"frac16", "\xE2\x85\x99"},
+				{"frac18", "\xE2\x85\x9B"},
+				{"frac23", "\xE2\x85\x94"},
+				{"frac25", "\xE2\x85\x96"},
+				{"frac34", "\xC2\xBE"},
+				{"frac35", "\xE2\x85\x97"},
+				{"frac38", "\xE2\x85\x9C"},
+				{"frac45", "\xE2\x85\x98"},
+				{"frac56", "\xE2\x85\x9A"},
+				{"frac58", "\xE2\x85\x9D"},
+				{"frac78", "\xE2\x85\x9E"},
+				{"frasl", "\xE2\x81\x84"},
+				{"frown", "\xE2\x8C\xA2"},
+				{"fscr", "\xF0\x9D\x92\xBB"},
+				{"gE", "\xE2\x89\xA7"},
+				{"gEl", "\xE2\xAA\x8C"},
+				{"gacute", "\xC7\xB5"},
+				{"gamma", "\xCE\xB3"},
+				{"gammad", "\xCF\x9D"},
+				{"gap", "\xE2\xAA\x86"},
+				{"gbreve", "\xC4\x9F"},
+				{"gcirc", "\xC4\x9D"},
+				{"gcy", "\xD0\xB3"},
+				{"gdot", "\xC4\xA1"},
+				{"ge", "\xE2\x89\xA5"},
+				{"gel", "\xE2\x8B\x9B"},
+				{"geq", "\xE2\x89\xA5"},
+				{"geqq", "\xE2\x89\xA7"},
+				{"geqslant", "\xE2\xA9\xBE"},
+				{"ges", "\xE2\xA9\xBE"},
+				{"gescc", "\xE2\xAA\xA9"},
+				{"gesdot", "\xE2\xAA\x80"},
+				{"gesdoto", "\xE2\xAA\x82"},
+				{"gesdotol", "\xE2\xAA\x84"},
+				{"gesl", "\xE2\x8B\x9B\xEF\xB8\x80"},
+				{"gesles", "\xE2\xAA\x94"},
+				{"gfr", "\xF0\x9D\x94\xA4"},
+				{"gg", "\xE2\x89\xAB"},
+				{"ggg", "\xE2\x8B\x99"},
+				{"gimel", "\xE2\x84\xB7"},
+				{"gjcy", "\xD1\x93"},
+				{"gl", "\xE2\x89\xB7"},
+				{"glE", "\xE2\xAA\x92"},
+				{"gla", "\xE2\xAA\xA5"},
+				{"glj", "\xE2\xAA\xA4"},
+				{"gnE", "\xE2\x89\xA9"},
+				{"gnap", "\xE2\xAA\x8A"},
+				{"gnapprox", "\xE2\xAA\x8A"},
+				{"gne", "\xE2\xAA\x88"},
+				{"gneq", "\xE2\xAA\x88"},
+				{"gneqq", "\xE2\x89\xA9"},
+				{"gnsim", "\xE2\x8B\xA7"},
+				{"gopf", "\xF0\x9D\x95\x98"},
+				{"grave", "`"},
+				{"gscr", "\xE2\x84\x8A"},
+				{"gsim", "\xE2\x89\xB3"},
+				{"gsime", "\xE2\xAA\x8E"},
+				{"gsiml", "\xE2\xAA\x90"},
+				{"gt", ">"},
+				{"gtcc", "\xE2\xAA\xA7"},
+				{"gtcir", "\xE2\xA9\xBA"},
+				{"gtdot", "\xE2\x8B\x97"},
+				{"gtlPar", "\xE2\xA6\x95"},
+				{"gtquest", "\xE2\xA9\xBC"},
+				{"gtrapprox", "\xE2\xAA\x86"},
+				{"gtrarr", "\xE2\xA5\xB8"},
+				{"gtrdot", "\xE2\x8B\x97"},
+				{"gtreqless", "\xE2\x8B\x9B"},
+				{"gtreqqless", "\xE2\xAA\x8C"},
+				{"gtrless", "\xE2\x89\xB7"},
+				{"gtrsim", "\xE2\x89\xB3"},
+				{"gvertneqq", "\xE2\x89\xA9\xEF\xB8\x80"},
+				{"gvnE", "\xE2\x89\xA9\xEF\xB8\x80"},
+				{"hArr", "\xE2\x87\x94"},
+				{"hairsp", "\xE2\x80\x8A"},
+				{"half", "\xC2\xBD"},
+				{"hamilt", "\xE2\x84\x8B"},
+				{"hardcy", "\xD1\x8A"},
+				{"harr", "\xE2\x86\x94"},
+				{"harrcir", "\xE2\xA5\x88"},
+				{"harrw", "\xE2\x86\xAD"},
+				{"hbar", "\xE2\x84\x8F"},
+				{"hcirc", "\xC4\xA5"},
+				{"hearts", "\xE2\x99\xA5"},
+				{"heartsuit", "\xE2\x99\xA5"},
+				{"hellip", "\xE2\x80\xA6"},
+				{"hercon", "\xE2\x8A\xB9"},
+				{"hfr", "\xF0\x9D\x94\xA5"},
+				{"hksearow", "\xE2\xA4\xA5"},
+				{"hkswarow", "\xE2\xA4\xA6"},
+				{"hoarr", "\xE2\x87\xBF"},
+				{"homtht", "\xE2\x88\xBB"},
+				{"hookleftarrow", "\xE2\x86\xA9"},
+				{"hookrightarrow", "\xE2\x86\xAA"},
+				{"hopf", "\xF0\x9D\x95\x99"},
+				{"horbar", "\xE2\x80\x95"},
+				{"hscr", "\xF0\x9D\x92\xBD"},
+				{"hslash", "\xE2\x84\x8F"},
+				{"hstrok", "\xC4\xA7"},
+				{"hybull", "\xE2\x81\x83"},
+				{"hyphen", "\xE2\x80\x90"},
+				{"iacute", "\xC3\xAD"},
+				{"ic", "\xE2\x81\xA3"},
+				{"icirc", "\xC3\xAE"},
+				{"icy", "\xD0\xB8"},
+				{"iecy", "\xD0\xB5"},
+				{"iexcl", "\xC2\xA1"},
+				{"iff", "\xE2\x87\x94"},
+				{"ifr", "\xF0\x9D\x94\xA6"},
+				{"igrave", "\xC3\xAC"},
+				{"ii", "\xE2\x85\x88"},
+				{"iiiint", "\xE2\xA8\x8C"},
+				{"iiint", "\xE2\x88\xAD"},
+				{"iinfin", "\xE2\xA7\x9C"},
+				{"iiota", "\xE2\x84\xA9"},
+				{"ijlig", "\xC4\xB3"},
+				{"imacr", "\xC4\xAB"},
+				{"image", "\xE2\x84\x91"},
+				{"imagline", "\xE2\x84\x90"},
+				{"imagpart", "\xE2\x84\x91"},
+				{"imath", "\xC4\xB1"},
+				{"imof", "\xE2\x8A\xB7"},
+				{"imped", "\xC6\xB5"},
+				{"in", "\xE2\x88\x88"},
+				{"incare", "\xE2\x84\x85"},
+				{"infin", "\xE2\x88\x9E"},
+				{"infintie", "\xE2\xA7\x9D"},
+				{"inodot", "\xC4\xB1"},
+				{"int", "\xE2\x88\xAB"},
+				{"intcal", "\xE2\x8A\xBA"},
+				{"integers", "\xE2\x84\xA4"},
+				{"intercal", "\xE2\x8A\xBA"},
+				{"intlarhk", "\xE2\xA8\x97"},
+				{"intprod", "\xE2\xA8\xBC"},
+				{"iocy", "\xD1\x91"},
+				{"iogon", "\xC4\xAF"},
+				{"iopf", "\xF0\x9D\x95\x9A"},
+				{"iota", "\xCE\xB9"},
+				{"iprod", "\xE2\xA8\xBC"},
+				{"iquest", "\xC2\xBF"},
+				{"iscr", "\xF0\x9D\x92\xBE"},
+				{"isin", "\xE2\x88\x88"},
+				{"isinE", "\xE2\x8B\xB9"},
+				{"isindot", "\xE2\x8B\xB5"},
+				{"isins", "\xE2\x8B\xB4"},
+				{"isinsv", "\xE2\x8B\xB3"},
+				{"isinv", "\xE2\x88\x88"},
+				{"it", "\xE2\x81\xA2"},
+				{"itilde", "\xC4\xA9"},
+				{"iukcy", "\xD1\x96"},
+				{"iuml", "\xC3\xAF"},
+				{"jcirc", "\xC4\xB5"},
+				{"jcy", "\xD0\xB9"},
+				{"jfr", "\xF0\x9D\x94\xA7"},
+				{"jmath", "\xC8\xB7"},
+				{"jopf", "\xF0\x9D\x95\x9B"},
+				{"jscr", "\xF0\x9D\x92\xBF"},
+				{"jsercy", "\xD1\x98"},
+				{"jukcy", "\xD1\x94"},
+				{"kappa", "\xCE\xBA"},
+				{"kappav", "\xCF\xB0"},
+				{"kcedil", "\xC4\xB7"},
+				{"kcy", "\xD0\xBA"},
+				{"kfr", "\xF0\x9D\x94\xA8"},
+				{"kgreen", "\xC4\xB8"},
+				{"khcy", "\xD1\x85"},
+				{"kjcy", "\xD1\x9C"},
+				{"kopf", "\xF0\x9D\x95\x9C"},
+				{"kscr", "\xF0\x9D\x93\x80"},
+				{"lAarr", "\xE2\x87\x9A"},
+				{"lArr", "\xE2\x87\x90"},
+				{"lAtail", "\xE2\xA4\x9B"},
+				{"lBarr", "\xE2\xA4\x8E"},
+				{"lE", "\xE2\x89\xA6"},
+				{"lEg", "\xE2\xAA\x8B"},
+				{"lHar", "\xE2\xA5\xA2"},
+				{"lacute", "\xC4\xBA"},
+				{"laemptyv", "\xE2\xA6\xB4"},
+				{"lagran", "\xE2\x84\x92"},
+				{"lambda", "\xCE\xBB"},
+				{"lang", "\xE2\x9F\xA8"},
+				{"langd", "\xE2\xA6\x91"},
+				{"langle", "\xE2\x9F\xA8"},
+				{"lap", "\xE2\xAA\x85"},
+				{"laquo", "\xC2\xAB"},
+				{"larr", "\xE2\x86\x90"},
+				{"larrb", "\xE2\x87\xA4"},
+				{"larrbfs", "\xE2\xA4\x9F"},
+				{"larrfs", "\xE2\xA4\x9D"},
+				{"larrhk", "\xE2\x86\xA9"},
+				{"larrlp", "\xE2\x86\xAB"},
+				{"larrpl", "\xE2\xA4\xB9"},
+				{"larrsim", "\xE2\xA5\xB3"},
+				{"larrtl", "\xE2\x86\xA2"},
+				{"lat", "\xE2\xAA\xAB"},
+				{"latail", "\xE2\xA4\x99"},
+				{"late", "\xE2\xAA\xAD"},
+				{"lates", "\xE2\xAA\xAD\xEF\xB8\x80"},
+				{"lbarr", "\xE2\xA4\x8C"},
+				{"lbbrk", "\xE2\x9D\xB2"},
+				{"lbrace", "{"},
+				{"lbrack", "["},
+				{"lbrke", "\xE2\xA6\x8B"},
+				{"lbrksld", "\xE2\xA6\x8F"},
+				{"lbrkslu", "\xE2\xA6\x8D"},
+				{"lcaron", "\xC4\xBE"},
+				{"lcedil", "\xC4\xBC"},
+				{"lceil", "\xE2\x8C\x88"},
+				{"lcub", "{"},
+				{"lcy", "\xD0\xBB"},
+				{"ldca", "\xE2\xA4\xB6"},
+				{"ldquo", "\xE2\x80\x9C"},
+				{"ldquor", "\xE2\x80\x9E"},
+				{"ldrdhar", "\xE2\xA5\xA7"},
+				{"ldrushar", "\xE2\xA5\x8B"},
+				{"ldsh", "\xE2\x86\xB2"},
+				{"le", "\xE2\x89\xA4"},
+				{"leftarrow", "\xE2\x86\x90"},
+				{"leftarrowtail", "\xE2\x86\xA2"},
+				{"leftharpoondown", "\xE2\x86\xBD"},
+				{"leftharpoonup", "\xE2\x86\xBC"},
+				{"leftleftarrows", "\xE2\x87\x87"},
+				{"leftrightarrow", "\xE2\x86\x94"},
+				{"leftrightarrows", "\xE2\x87\x86"},
+				{"leftrightharpoons", "\xE2\x87\x8B"},
+				{"leftrightsquigarrow", "\xE2\x86\xAD"},
+				{"leftthreetimes", "\xE2\x8B\x8B"},
+				{"leg", "\xE2\x8B\x9A"},
+				{"leq", "\xE2\x89\xA4"},
+				{"leqq", "\xE2\x89\xA6"},
+				{"leqslant", "\xE2\xA9\xBD"},
+				{"les", "\xE2\xA9\xBD"},
+				{"lescc", "\xE2\xAA\xA8"},
+				{"lesdot", "\xE2\xA9\xBF"},
+				{"lesdoto", "\xE2\xAA\x81"},
+				{"lesdotor", "\xE2\xAA\x83"},
+				{"lesg", "\xE2\x8B\x9A\xEF\xB8\x80"},
+				{"lesges", "\xE2\xAA\x93"},
+				{"lessapprox", "\xE2\xAA\x85"},
+				{"lessdot", "\xE2\x8B\x96"},
+				{"lesseqgtr", "\xE2\x8B\x9A"},
+				{"lesseqqgtr", "\xE2\xAA\x8B"},
+				{"lessgtr", "\xE2\x89\xB6"},
+				{"lesssim", "\xE2\x89\xB2"},
+				{"lfisht", "\xE2\xA5\xBC"},
+				{"lfloor", "\xE2\x8C\x8A"},
+				{"lfr", "\xF0\x9D\x94\xA9"},
+				{"lg", "\xE2\x89\xB6"},
+				{"lgE", "\xE2\xAA\x91"},
+				{"lhard", "\xE2\x86\xBD"},
+				{"lharu", "\xE2\x86\xBC"},
+				{"lharul", "\xE2\xA5\xAA"},
+				{"lhblk", "\xE2\x96\x84"},
+				{"ljcy", "\xD1\x99"},
+				{"ll", "\xE2\x89\xAA"},
+				{"llarr", "\xE2\x87\x87"},
+				{"llcorner", "\xE2\x8C\x9E"},
+				{"llhard", "\xE2\xA5\xAB"},
+				{"lltri", "\xE2\x97\xBA"},
+				{"lmidot", "\xC5\x80"},
+				{"lmoust", "\xE2\x8E\xB0"},
+				{"lmoustache", "\xE2\x8E\xB0"},
+				{"lnE", "\xE2\x89\xA8"},
+				{"lnap", "\xE2\xAA\x89"},
+				{"lnapprox", "\xE2\xAA\x89"},
+				{"lne", "\xE2\xAA\x87"},
+				{"lneq", "\xE2\xAA\x87"},
+				{"lneqq", "\xE2\x89\xA8"},
+				{"lnsim", "\xE2\x8B\xA6"},
+				{"loang", "\xE2\x9F\xAC"},
+				{"loarr", "\xE2\x87\xBD"},
+				{"lobrk", "\xE2\x9F\xA6"},
+				{"longleftarrow", "\xE2\x9F\xB5"},
+				{"longleftrightarrow", "\xE2\x9F\xB7"},
+				{"longmapsto", "\xE2\x9F\xBC"},
+				{"longrightarrow", "\xE2\x9F\xB6"},
+				{"looparrowleft", "\xE2\x86\xAB"},
+				{"looparrowright", "\xE2\x86\xAC"},
+				{"lopar", "\xE2\xA6\x85"},
+				{"lopf", "\xF0\x9D\x95\x9D"},
+				{"loplus", "\xE2\xA8\xAD"},
+				{"lotimes", "\xE2\xA8\xB4"},
+				{"lowast", "\xE2\x88\x97"},
+				{"lowbar", "_"},
+				{"loz", "\xE2\x97\x8A"},
+				{"lozenge", "\xE2\x97\x8A"},
+				{"lozf", "\xE2\xA7\xAB"},
+				{"lpar", "("},
+				{"lparlt", "\xE2\xA6\x93"},
+				{"lrarr", "\xE2\x87\x86"},
+				{"lrcorner", "\xE2\x8C\x9F"},
+				{"lrhar", "\xE2\x87\x8B"},
+				{"lrhard", "\xE2\xA5\xAD"},
+				{"lrm", "\xE2\x80\x8E"},
+				{"lrtri", "\xE2\x8A\xBF"},
+				{"lsaquo", "\xE2\x80\xB9"},
+				{"lscr", "\xF0\x9D\x93\x81"},
+				{"lsh", "\xE2\x86\xB0"},
+				{"lsim", "\xE2\x89\xB2"},
+				{"lsime", "\xE2\xAA\x8D"},
+				{"lsimg", "\xE2\xAA\x8F"},
+				{"lsqb", "["},
+				{"lsquo", "\xE2\x80\x98"},
+				{"lsquor", "\xE2\x80\x9A"},
+				{"lstrok", "\xC5\x82"},
+				{"lt", "<"},
+				{"ltcc", "\xE2\xAA\xA6"},
+				{"ltcir", "\xE2\xA9\xB9"},
+				{"ltdot", "\xE2\x8B\x96"},
+				{"lthree", "\xE2\x8B\x8B"},
+				{"ltimes", "\xE2\x8B\x89"},
+				{"ltlarr", "\xE2\xA5\xB6"},
+				{"ltquest", "\xE2\xA9\xBB"},
+				{"ltrPar", "\xE2\xA6\x96"},
+				{"ltri", "\xE2\x97\x83"},
+				{"ltrie", "\xE2\x8A\xB4"},
+				{"ltrif", "\xE2\x97\x82"},
+				{"lurdshar", "\xE2\xA5\x8A"},
+				{"luruhar", "\xE2\xA5\xA6"},
+				{"lvertneqq", "\xE2\x89\xA8\xEF\xB8\x80"},
+				{"lvnE", "\xE2\x89\xA8\xEF\xB8\x80"},
+				{"mDDot", "\xE2\x88\xBA"},
+				{"macr", "\xC2\xAF"},
+				{"male", "\xE2\x99\x82"},
+				{"malt", "\xE2\x9C\xA0"},
+				{"maltese", "\xE2\x9C\xA0"},
+				{"map", "\xE2\x86\xA6"},
+				{"mapsto", "\xE2\x86\xA6"},
+				{"mapstodown", "\xE2\x86\xA7"},
+				{"mapstoleft", "\xE2\x86\xA4"},
+				{"mapstoup", "\xE2\x86\xA5"},
+				{"marker", "\xE2\x96\xAE"},
+				{"mcomma", "\xE2\xA8\xA9"},
+				{"mcy", "\xD0\xBC"},
+				{"mdash", "\xE2\x80\x94"},
+				{"measuredangle", "\xE2\x88\xA1"},
+				{"mfr", "\xF0\x9D\x94\xAA"},
+				{"mho", "\xE2\x84\xA7"},
+				{"micro", "\xC2\xB5"},
+				{"mid", "\xE2\x88\xA3"},
+				{"midast", "*"},
+				{"midcir", "\xE2\xAB\xB0"},
+				{"middot", "\xC2\xB7"},
+				{"minus", "\xE2\x88\x92"},
+				{"minusb", "\xE2\x8A\x9F"},
+				{"minusd", "\xE2\x88\xB8"},
+				{"minusdu", "\xE2\xA8\xAA"},
+				{"mlcp", "\xE2\xAB\x9B"},
+				{"mldr", "\xE2\x80\xA6"},
+				{"mnplus", "\xE2\x88\x93"},
+				{"models", "\xE2\x8A\xA7"},
+				{"mopf", "\xF0\x9D\x95\x9E"},
+				{"mp", "\xE2\x88\x93"},
+				{"mscr", "\xF0\x9D\x93\x82"},
+				{"mstpos", "\xE2\x88\xBE"},
+				{"mu", "\xCE\xBC"},
+				{"multimap", "\xE2\x8A\xB8"},
+				{"mumap", "\xE2\x8A\xB8"},
+				{"nGg", "\xE2\x8B\x99\xCC\xB8"},
+				{"nGt", "\xE2\x89\xAB\xE2\x83\x92"},
+				{"nGtv", "\xE2\x89\xAB\xCC\xB8"},
+				{"nLeftarrow", "\xE2\x87\x8D"},
+				{"nLeftrightarrow", "\xE2\x87\x8E"},
+				{"nLl", "\xE2\x8B\x98\xCC\xB8"},
+				{"nLt", "\xE2\x89\xAA\xE2\x83\x92"},
+				{"nLtv", "\xE2\x89\xAA\xCC\xB8"},
+				{"nRightarrow", "\xE2\x87\x8F"},
+				{"nVDash", "\xE2\x8A\xAF"},
+				{"nVdash", "\xE2\x8A\xAE"},
+				{"nabla", "\xE2\x88\x87"},
+				{"nacute", "\xC5\x84"},
+				{"nang", "\xE2\x88\xA0\xE2\x83\x92"},
+				{"nap", "\xE2\x89\x89"},
+				{"napE", "\xE2\xA9\xB0\xCC\xB8"},
+				{"napid", "\xE2\x89\x8B\xCC\xB8"},
+				{"napos", "\xC5\x89"},
+				{"napprox", "\xE2\x89\x89"},
+				{"natur", "\xE2\x99\xAE"},
+				{"natural", "\xE2\x99\xAE"},
+				{"naturals", "\xE2\x84\x95"},
+				{"nbsp", "\xC2\xA0"},
+				{"nbump", "\xE2\x89\x8E\xCC\xB8"},
+				{"nbumpe", "\xE2\x89\x8F\xCC\xB8"},
+				{"ncap", "\xE2\xA9\x83"},
+				{"ncaron", "\xC5\x88"},
+				{"ncedil", "\xC5\x86"},
+				{"ncong", "\xE2\x89\x87"},
+				{"ncongdot", "\xE2\xA9\xAD\xCC\xB8"},
+				{"ncup", "\xE2\xA9\x82"},
+				{"ncy", "\xD0\xBD"},
+				{"ndash", "\xE2\x80\x93"},
+				{"ne", "\xE2\x89\xA0"},
+				{"neArr", "\xE2\x87\x97"},
+				{"nearhk", "\xE2\xA4\xA4"},
+				{"nearr", "\xE2\x86\x97"},
+				{"nearrow", "\xE2\x86\x97"},
+				{"nedot", "\xE2\x89\x90\xCC\xB8"},
+				{"nequiv", "\xE2\x89\xA2"},
+				{"nesear", "\xE2\xA4\xA8"},
+				{"nesim", "\xE2\x89\x82\xCC\xB8"},
+				{"nexist", "\xE2\x88\x84"},
+				{"nexists", "\xE2\x88\x84"},
+				{"nfr", "\xF0\x9D\x94\xAB"},
+				{"ngE", "\xE2\x89\xA7\xCC\xB8"},
+				{"nge", "\xE2\x89\xB1"},
+				{"ngeq", "\xE2\x89\xB1"},
+				{"ngeqq", "\xE2\x89\xA7\xCC\xB8"},
+				{"ngeqslant", "\xE2\xA9\xBE\xCC\xB8"},
+				{"nges", "\xE2\xA9\xBE\xCC\xB8"},
+				{"ngsim", "\xE2\x89\xB5"},
+				{"ngt", "\xE2\x89\xAF"},
+				{"ngtr", "\xE2\x89\xAF"},
+				{"nhArr", "\xE2\x87\x8E"},
+				{"nharr", "\xE2\x86\xAE"},
+				{"nhpar", "\xE2\xAB\xB2"},
+				{"ni", "\xE2\x88\x8B"},
+				{"nis", "\xE2\x8B\xBC"},
+				{"nisd", "\xE2\x8B\xBA"},
+				{"niv", "\xE2\x88\x8B"},
+				{"njcy", "\xD1\x9A"},
+				{"nlArr", "\xE2\x87\x8D"},
+				{"nlE", "\xE2\x89\xA6\xCC\xB8"},
+				{"nlarr", "\xE2\x86\x9A"},
+				{"nldr", "\xE2\x80\xA5"},
+				{"nle", "\xE2\x89\xB0"},
+				{"nleftarrow", "\xE2\x86\x9A"},
+				{"nleftrightarrow", "\xE2\x86\xAE"},
+				{"nleq", "\xE2\x89\xB0"},
+				{"nleqq", "\xE2\x89\xA6\xCC\xB8"},
+				{"nleqslant", "\xE2\xA9\xBD\xCC\xB8"},
+				{"nles", "\xE2\xA9\xBD\xCC\xB8"},
+				{"nless", "\xE2\x89\xAE"},
+				{"nlsim", "\xE2\x89\xB4"},
+				{"nlt", "\xE2\x89\xAE"},
+				{"nltri", "\xE2\x8B\xAA"},
+				{"nltrie", "\xE2\x8B\xAC"},
+				{"nmid", "\xE2\x88\xA4"},
+				{"nopf", "\xF0\x9D\x95\x9F"},
+				{"not", "\xC2\xAC"},
+				{"notin", "\xE2\x88\x89"},
+				{"notinE", "\xE2\x8B\xB9\xCC\xB8"},
+				{"notindot", "\xE2\x8B\xB5\xCC\xB8"},
+				{"notinva", "\xE2\x88\x89"},
+				{"notinvb", "\xE2\x8B\xB7"},
+				{"notinvc", "\xE2\x8B\xB6"},
+				{"notni", "\xE2\x88\x8C"},
+				{"notniva", "\xE2\x88\x8C"},
+				{"notnivb", "\xE2\x8B\xBE"},
+				{"notnivc", "\xE2\x8B\xBD"},
+				{"npar", "\xE2\x88\xA6"},
+				{"nparallel", "\xE2\x88\xA6"},
+				{"nparsl", "\xE2\xAB\xBD\xE2\x83\xA5"},
+				{"npart", "\xE2\x88\x82\xCC\xB8"},
+				{"npolint", "\xE2\xA8\x94"},
+				{"npr", "\xE2\x8A\x80"},
+				{"nprcue", "\xE2\x8B\xA0"},
+				{"npre", "\xE2\xAA\xAF\xCC\xB8"},
+				{"nprec", "\xE2\x8A\x80"},
+				{"npreceq", "\xE2\xAA\xAF\xCC\xB8"},
+				{"nrArr", "\xE2\x87\x8F"},
+				{"nrarr", "\xE2\x86\x9B"},
+				{"nrarrc", "\xE2\xA4\xB3\xCC\xB8"},
+				{"nrarrw", "\xE2\x86\x9D\xCC\xB8"},
+				{"nrightarrow", "\xE2\x86\x9B"},
+				{"nrtri", "\xE2\x8B\xAB"},
+				{"nrtrie", "\xE2\x8B\xAD"},
+				{"nsc", "\xE2\x8A\x81"},
+				{"nsccue", "\xE2\x8B\xA1"},
+				{"nsce", "\xE2\xAA\xB0\xCC\xB8"},
+				{"nscr", "\xF0\x9D\x93\x83"},
+				{"nshortmid", "\xE2\x88\xA4"},
+				{"nshortparallel", "\xE2\x88\xA6"},
+				{"nsim", "\xE2\x89\x81"},
+				{"nsime", "\xE2\x89\x84"},
+				{"nsimeq", "\xE2\x89\x84"},
+				{"nsmid", "\xE2\x88\xA4"},
+				{"nspar", "\xE2\x88\xA6"},
+				{"nsqsube", "\xE2\x8B\xA2"},
+				{"nsqsupe", "\xE2\x8B\xA3"},
+				{"nsub", "\xE2\x8A\x84"},
+				{"nsubE", "\xE2\xAB\x85\xCC\xB8"},
+				{"nsube", "\xE2\x8A\x88"},
+				{"nsubset", "\xE2\x8A\x82\xE2\x83\x92"},
+				{"nsubseteq", "\xE2\x8A\x88"},
+				{"nsubseteqq", "\xE2\xAB\x85\xCC\xB8"},
+				{"nsucc", "\xE2\x8A\x81"},
+				{"nsucceq", "\xE2\xAA\xB0\xCC\xB8"},
+				{"nsup", "\xE2\x8A\x85"},
+				{"nsupE", "\xE2\xAB\x86\xCC\xB8"},
+				{"nsupe", "\xE2\x8A\x89"},
+				{"nsupset", "\xE2\x8A\x83\xE2\x83\x92"},
+				{"nsupseteq", "\xE2\x8A\x89"},
+				{"nsupseteqq", "\xE2\xAB\x86\xCC\xB8"},
+				{"ntgl", "\xE2\x89\xB9"},
+				{"ntilde", "\xC3\xB1"},
+				{"ntlg", "\xE2\x89\xB8"},
+				{"ntriangleleft", "\xE2\x8B\xAA"},
+				{"ntrianglelefteq", "\xE2\x8B\xAC"},
+				{"ntriangleright", "\xE2\x8B\xAB"},
+				{"ntrianglerighteq", "\xE2\x8B\xAD"},
+				{"nu", "\xCE\xBD"},
+				{"num", "#"},
+				{"numero", "\xE2\x84\x96"},
+				{"numsp", "\xE2\x80\x87"},
+				{"nvDash", "\xE2\x8A\xAD"},
+				{"nvHarr", "\xE2\xA4\x84"},
+				{"nvap", "\xE2\x89\x8D\xE2\x83\x92"},
+				{"nvdash", "\xE2\x8A\xAC"},
+				{"nvge", "\xE2\x89\xA5\xE2\x83\x92"},
+				{"nvgt", ">\xE2\x83\x92"},
+				{"nvinfin", "\xE2\xA7\x9E"},
+				{"nvlArr", "\xE2\xA4\x82"},
+				{"nvle", "\xE2\x89\xA4\xE2\x83\x92"},
+				{"nvlt", "<\xE2\x83\x92"},
+				{"nvltrie", "\xE2\x8A\xB4\xE2\x83\x92"},
+				{"nvrArr", "\xE2\xA4\x83"},
+				{"nvrtrie", "\xE2\x8A\xB5\xE2\x83\x92"},
+				{"nvsim", "\xE2\x88\xBC\xE2\x83\x92"},
+				{"nwArr", "\xE2\x87\x96"},
+				{"nwarhk", "\xE2\xA4\xA3"},
+				{"nwarr", "\xE2\x86\x96"},
+				{"nwarrow", "\xE2\x86\x96"},
+				{"nwnear", "\xE2\xA4\xA7"},
+				{"oS", "\xE2\x93\x88"},
+				{"oacute", "\xC3\xB3"},
+				{"oast", "\xE2\x8A\x9B"},
+				{"ocir", "\xE2\x8A\x9A"},
+				{"ocirc", "\xC3\xB4"},
+				{"ocy", "\xD0\xBE"},
+				{"odash", "\xE2\x8A\x9D"},
+				{"odblac", "\xC5\x91"},
+				{"odiv", "\xE2\xA8\xB8"},
+				{"odot", "\xE2\x8A\x99"},
+				{"odsold", "\xE2\xA6\xBC"},
+				{"oelig", "\xC5\x93"},
+				{"ofcir", "\xE2\xA6\xBF"},
+				{"ofr", "\xF0\x9D\x94\xAC"},
+				{"ogon", "\xCB\x9B"},
+				{"ograve", "\xC3\xB2"},
+				{"ogt", "\xE2\xA7\x81"},
+				{"ohbar", "\xE2\xA6\xB5"},
+				{"ohm", "\xCE\xA9"},
+				{"oint", "\xE2\x88\xAE"},
+				{"olarr", "\xE2\x86\xBA"},
+				{"olcir", "\xE2\xA6\xBE"},
+				{"olcross", "\xE2\xA6\xBB"},
+				{"oline", "\xE2\x80\xBE"},
+				{"olt", "\xE2\xA7\x80"},
+				{"omacr", "\xC5\x8D"},
+				{"omega", "\xCF\x89"},
+				{"omicron", "\xCE\xBF"},
+				{"omid", "\xE2\xA6\xB6"},
+				{"ominus", "\xE2\x8A\x96"},
+				{"oopf", "\xF0\x9D\x95\xA0"},
+				{"opar", "\xE2\xA6\xB7"},
+				{"operp", "\xE2\xA6\xB9"},
+				{"oplus", "\xE2\x8A\x95"},
+				{"or", "\xE2\x88\xA8"},
+				{"orarr", "\xE2\x86\xBB"},
+				{"ord", "\xE2\xA9\x9D"},
+				{"order", "\xE2\x84\xB4"},
+				{"orderof", "\xE2\x84\xB4"},
+				{"ordf", "\xC2\xAA"},
+				{"ordm", "\xC2\xBA"},
+				{"origof", "\xE2\x8A\xB6"},
+				{"oror", "\xE2\xA9\x96"},
+				{"orslope", "\xE2\xA9\x97"},
+				{"orv", "\xE2\xA9\x9B"},
+				{"oscr", "\xE2\x84\xB4"},
+				{"oslash", "\xC3\xB8"},
+				{"osol", "\xE2\x8A\x98"},
+				{"otilde", "\xC3\xB5"},
+				{"otimes", "\xE2\x8A\x97"},
+				{"otimesas", "\xE2\xA8\xB6"},
+				{"ouml", "\xC3\xB6"},
+				{"ovbar", "\xE2\x8C\xBD"},
+				{"par", "\xE2\x88\xA5"},
+				{"para", "\xC2\xB6"},
+				{"parallel", "\xE2\x88\xA5"},
+				{"parsim", "\xE2\xAB\xB3"},
+				{"parsl", "\xE2\xAB\xBD"},
+				{"part", "\xE2\x88\x82"},
+				{"pcy", "\xD0\xBF"},
+				{"percnt", "%"},
+				{"period", "."},
+				{"permil", "\xE2\x80\xB0"},
+				{"perp", "\xE2\x8A\xA5"},
+				{"pertenk", "\xE2\x80\xB1"},
+				{"pfr", "\xF0\x9D\x94\xAD"},
+				{"phi", "\xCF\x86"},
+				{"phiv", "\xCF\x95"},
+				{"phmmat", "\xE2\x84\xB3"},
+				{"phone", "\xE2\x98\x8E"},
+				{"pi", "\xCF\x80"},
+				{"pitchfork", "\xE2\x8B\x94"},
+				{"piv", "\xCF\x96"},
+				{"planck", "\xE2\x84\x8F"},
+				{"planckh", "\xE2\x84\x8E"},
+				{"plankv", "\xE2\x84\x8F"},
+				{"plus", "+"},
+				{"plusacir", "\xE2\xA8\xA3"},
+				{"plusb", "\xE2\x8A\x9E"},
+				{"pluscir", "\xE2\xA8\xA2"},
+				{"plusdo", "\xE2\x88\x94"},
+				{"plusdu", "\xE2\xA8\xA5"},
+				{"pluse", "\xE2\xA9\xB2"},
+				{"plusmn", "\xC2\xB1"},
+				{"plussim", "\xE2\xA8\xA6"},
+				{"plustwo", "\xE2\xA8\xA7"},
+				{"pm", "\xC2\xB1"},
+				{"pointint", "\xE2\xA8\x95"},
+				{"popf", "\xF0\x9D\x95\xA1"},
+				{"pound", "\xC2\xA3"},
+				{"pr", "\xE2\x89\xBA"},
+				{"prE", "\xE2\xAA\xB3"},
+				{"prap", "\xE2\xAA\xB7"},
+				{"prcue", "\xE2\x89\xBC"},
+				{"pre", "\xE2\xAA\xAF"},
+				{"prec", "\xE2\x89\xBA"},
+				{"precapprox", "\xE2\xAA\xB7"},
+				{"preccurlyeq", "\xE2\x89\xBC"},
+				{"preceq", "\xE2\xAA\xAF"},
+				{"precnapprox", "\xE2\xAA\xB9"},
+				{"precneqq", "\xE2\xAA\xB5"},
+				{"precnsim", "\xE2\x8B\xA8"},
+				{"precsim", "\xE2\x89\xBE"},
+				{"prime", "\xE2\x80\xB2"},
+				{"primes", "\xE2\x84\x99"},
+				{"prnE", "\xE2\xAA\xB5"},
+				{"prnap", "\xE2\xAA\xB9"},
+				{"prnsim", "\xE2\x8B\xA8"},
+				{"prod", "\xE2\x88\x8F"},
+				{"profalar", "\xE2\x8C\xAE"},
+				{"profline", "\xE2\x8C\x92"},
+				{"profsurf", "\xE2\x8C\x93"},
+				{"prop", "\xE2\x88\x9D"},
+				{"propto", "\xE2\x88\x9D"},
+				{"prsim", "\xE2\x89\xBE"},
+				{"prurel", "\xE2\x8A\xB0"},
+				{"pscr", "\xF0\x9D\x93\x85"},
+				{"psi", "\xCF\x88"},
+				{"puncsp", "\xE2\x80\x88"},
+				{"qfr", "\xF0\x9D\x94\xAE"},
+				{"qint", "\xE2\xA8\x8C"},
+				{"qopf", "\xF0\x9D\x95\xA2"},
+				{"qprime", "\xE2\x81\x97"},
+				{"qscr", "\xF0\x9D\x93\x86"},
+				{"quaternions", "\xE2\x84\x8D"},
+				{"quatint", "\xE2\xA8\x96"},
+				{"quest", "\x3F"},
+				{"questeq", "\xE2\x89\x9F"},
+				{"quot", "\x22"},
+				{"rAarr", "\xE2\x87\x9B"},
+				{"rArr", "\xE2\x87\x92"},
+				{"rAtail", "\xE2\xA4\x9C"},
+				{"rBarr", "\xE2\xA4\x8F"},
+				{"rHar", "\xE2\xA5\xA4"},
+				{"race", "\xE2\x88\xBD\xCC\xB1"},
+				{"racute", "\xC5\x95"},
+				{"radic", "\xE2\x88\x9A"},
+				{"raemptyv", "\xE2\xA6\xB3"},
+				{"rang", "\xE2\x9F\xA9"},
+				{"rangd", "\xE2\xA6\x92"},
+				{"range", "\xE2\xA6\xA5"},
+				{"rangle", "\xE2\x9F\xA9"},
+				{"raquo", "\xC2\xBB"},
+				{"rarr", "\xE2\x86\x92"},
+				{"rarrap", "\xE2\xA5\xB5"},
+				{"rarrb", "\xE2\x87\xA5"},
+				{"rarrbfs", "\xE2\xA4\xA0"},
+				{"rarrc", "\xE2\xA4\xB3"},
+				{"rarrfs", "\xE2\xA4\x9E"},
+				{"rarrhk", "\xE2\x86\xAA"},
+				{"rarrlp", "\xE2\x86\xAC"},
+				{"rarrpl", "\xE2\xA5\x85"},
+				{"rarrsim", "\xE2\xA5\xB4"},
+				{"rarrtl", "\xE2\x86\xA3"},
+				{"rarrw", "\xE2\x86\x9D"},
+				{"ratail", "\xE2\xA4\x9A"},
+				{"ratio", "\xE2\x88\xB6"},
+				{"rationals", "\xE2\x84\x9A"},
+				{"rbarr", "\xE2\xA4\x8D"},
+				{"rbbrk", "\xE2\x9D\xB3"},
+				{"rbrace", "}"},
+				{"rbrack", "]"},
+				{"rbrke", "\xE2\xA6\x8C"},
+				{"rbrksld", "\xE2\xA6\x8E"},
+				{"rbrkslu", "\xE2\xA6\x90"},
+				{"rcaron", "\xC5\x99"},
+				{"rcedil", "\xC5\x97"},
+				{"rceil", "\xE2\x8C\x89"},
+				{"rcub", "}"},
+				{"rcy", "\xD1\x80"},
+				{"rdca", "\xE2\xA4\xB7"},
+				{"rdldhar", "\xE2\xA5\xA9"},
+				{"rdquo", "\xE2\x80\x9D"},
+				{"rdquor", "\xE2\x80\x9D"},
+				{"rdsh", "\xE2\x86\xB3"},
+				{"real", "\xE2\x84\x9C"},
+				{"realine", "\xE2\x84\x9B"},
+				{"realpart", "\xE2\x84\x9C"},
+				{"reals", "\xE2\x84\x9D"},
+				{"rect", "\xE2\x96\xAD"},
+				{"reg", "\xC2\xAE"},
+				{"rfisht", "\xE2\xA5\xBD"},
+				{"rfloor", "\xE2\x8C\x8B"},
+				{"rfr", "\xF0\x9D\x94\xAF"},
+				{"rhard", "\xE2\x87\x81"},
+				{"rharu", "\xE2\x87\x80"},
+				{"rharul", "\xE2\xA5\xAC"},
+				{"rho", "\xCF\x81"},
+				{"rhov", "\xCF\xB1"},
+				{"rightarrow", "\xE2\x86\x92"},
+				{"rightarrowtail", "\xE2\x86\xA3"},
+				{"rightharpoondown", "\xE2\x87\x81"},
+				{"rightharpoonup", "\xE2\x87\x80"},
+				{"rightleftarrows", "\xE2\x87\x84"},
+				{"rightleftharpoons", "\xE2\x87\x8C"},
+				{"rightrightarrows", "\xE2\x87\x89"},
+				{"rightsquigarrow", "\xE2\x86\x9D"},
+				{"rightthreetimes", "\xE2\x8B\x8C"},
+				{"ring", "\xCB\x9A"},
+				{"risingdotseq", "\xE2\x89\x93"},
+				{"rlarr", "\xE2\x87\x84"},
+				{"rlhar", "\xE2\x87\x8C"},
+				{"rlm", "\xE2\x80\x8F"},
+				{"rmoust", "\xE2\x8E\xB1"},
+				{"rmoustache", "\xE2\x8E\xB1"},
+				{"rnmid", "\xE2\xAB\xAE"},
+				{"roang", "\xE2\x9F\xAD"},
+				{"roarr", "\xE2\x87\xBE"},
+				{"robrk", "\xE2\x9F\xA7"},
+				{"ropar", "\xE2\xA6\x86"},
+				{"ropf", "\xF0\x9D\x95\xA3"},
+				{"roplus", "\xE2\xA8\xAE"},
+				{"rotimes", "\xE2\xA8\xB5"},
+				{"rpar", ")"},
+				{"rpargt", "\xE2\xA6\x94"},
+				{"rppolint", "\xE2\xA8\x92"},
+				{"rrarr", "\xE2\x87\x89"},
+				{"rsaquo", "\xE2\x80\xBA"},
+				{"rscr", "\xF0\x9D\x93\x87"},
+				{"rsh", "\xE2\x86\xB1"},
+				{"rsqb", "]"},
+				{"rsquo", "\xE2\x80\x99"},
+				{"rsquor", "\xE2\x80\x99"},
+				{"rthree", "\xE2\x8B\x8C"},
+				{"rtimes", "\xE2\x8B\x8A"},
+				{"rtri", "\xE2\x96\xB9"},
+				{"rtrie", "\xE2\x8A\xB5"},
+				{"rtrif", "\xE2\x96\xB8"},
+				{"rtriltri", "\xE2\xA7\x8E"},
+				{"ruluhar", "\xE2\xA5\xA8"},
+				{"rx", "\xE2\x84\x9E"},
+				{"sacute", "\xC5\x9B"},
+				{"sbquo", "\xE2\x80\x9A"},
+				{"sc", "\xE2\x89\xBB"},
+				{"scE", "\xE2\xAA\xB4"},
+				{"scap", "\xE2\xAA\xB8"},
+				{"scaron", "\xC5\xA1"},
+				{"sccue", "\xE2\x89\xBD"},
+				{"sce", "\xE2\xAA\xB0"},
+				{"scedil", "\xC5\x9F"},
+				{"scirc", "\xC5\x9D"},
+				{"scnE", "\xE2\xAA\xB6"},
+				{"scnap", "\xE2\xAA\xBA"},
+				{"scnsim", "\xE2\x8B\xA9"},
+				{"scpolint", "\xE2\xA8\x93"},
+				{"scsim", "\xE2\x89\xBF"},
+				{"scy", "\xD1\x81"},
+				{"sdot", "\xE2\x8B\x85"},
+				{"sdotb", "\xE2\x8A\xA1"},
+				{"sdote", "\xE2\xA9\xA6"},
+				{"seArr", "\xE2\x87\x98"},
+				{"searhk", "\xE2\xA4\xA5"},
+				{"searr", "\xE2\x86\x98"},
+				{"searrow", "\xE2\x86\x98"},
+				{"sect", "\xC2\xA7"},
+				{"semi", ";"},
+				{"seswar", "\xE2\xA4\xA9"},
+				{"setminus", "\xE2\x88\x96"},
+				{"setmn", "\xE2\x88\x96"},
+				{"sext", "\xE2\x9C\xB6"},
+				{"sfr", "\xF0\x9D\x94\xB0"},
+				{"sfrown", "\xE2\x8C\xA2"},
+				{"sharp", "\xE2\x99\xAF"},
+				{"shchcy", "\xD1\x89"},
+				{"shcy", "\xD1\x88"},
+				{"shortmid", "\xE2\x88\xA3"},
+				{"shortparallel", "\xE2\x88\xA5"},
+				{"shy", "\xC2\xAD"},
+				{"sigma", "\xCF\x83"},
+				{"sigmaf", "\xCF\x82"},
+				{"sigmav", "\xCF\x82"},
+				{"sim", "\xE2\x88\xBC"},
+				{"simdot", "\xE2\xA9\xAA"},
+				{"sime", "\xE2\x89\x83"},
+				{"simeq", "\xE2\x89\x83"},
+				{"simg", "\xE2\xAA\x9E"},
+				{"simgE", "\xE2\xAA\xA0"},
+				{"siml", "\xE2\xAA\x9D"},
+				{"simlE", "\xE2\xAA\x9F"},
+				{"simne", "\xE2\x89\x86"},
+				{"simplus", "\xE2\xA8\xA4"},
+				{"simrarr", "\xE2\xA5\xB2"},
+				{"slarr", "\xE2\x86\x90"},
+				{"smallsetminus", "\xE2\x88\x96"},
+				{"smashp", "\xE2\xA8\xB3"},
+				{"smeparsl", "\xE2\xA7\xA4"},
+				{"smid", "\xE2\x88\xA3"},
+				{"smile", "\xE2\x8C\xA3"},
+				{"smt", "\xE2\xAA\xAA"},
+				{"smte", "\xE2\xAA\xAC"},
+				{"smtes", "\xE2\xAA\xAC\xEF\xB8\x80"},
+				{"softcy", "\xD1\x8C"},
+				{"sol", "/"},
+				{"solb", "\xE2\xA7\x84"},
+				{"solbar", "\xE2\x8C\xBF"},
+				{"sopf", "\xF0\x9D\x95\xA4"},
+				{"spades", "\xE2\x99\xA0"},
+				{"spadesuit", "\xE2\x99\xA0"},
+				{"spar", "\xE2\x88\xA5"},
+				{"sqcap", "\xE2\x8A\x93"},
+				{"sqcaps", "\xE2\x8A\x93\xEF\xB8\x80"},
+				{"sqcup", "\xE2\x8A\x94"},
+				{"sqcups", "\xE2\x8A\x94\xEF\xB8\x80"},
+				{"sqsub", "\xE2\x8A\x8F"},
+				{"sqsube", "\xE2\x8A\x91"},
+				{"sqsubset", "\xE2\x8A\x8F"},
+				{"sqsubseteq", "\xE2\x8A\x91"},
+				{"sqsup", "\xE2\x8A\x90"},
+				{"sqsupe", "\xE2\x8A\x92"},
+				{"sqsupset", "\xE2\x8A\x90"},
+				{"sqsupseteq", "\xE2\x8A\x92"},
+				{"squ", "\xE2\x96\xA1"},
+				{"square", "\xE2\x96\xA1"},
+				{"squarf", "\xE2\x96\xAA"},
+				{"squf", "\xE2\x96\xAA"},
+				{"srarr", "\xE2\x86\x92"},
+				{"sscr", "\xF0\x9D\x93\x88"},
+				{"ssetmn", "\xE2\x88\x96"},
+				{"ssmile", "\xE2\x8C\xA3"},
+				{"sstarf", "\xE2\x8B\x86"},
+				{"star", "\xE2\x98\x86"},
+				{"starf", "\xE2\x98\x85"},
+				{"straightepsilon", "\xCF\xB5"},
+				{"straightphi", "\xCF\x95"},
+				{"strns", "\xC2\xAF"},
+				{"sub", "\xE2\x8A\x82"},
+				{"subE", "\xE2\xAB\x85"},
+				{"subdot", "\xE2\xAA\xBD"},
+				{"sube", "\xE2\x8A\x86"},
+				{"subedot", "\xE2\xAB\x83"},
+				{"submult", "\xE2\xAB\x81"},
+				{"subnE", "\xE2\xAB\x8B"},
+				{"subne", "\xE2\x8A\x8A"},
+				{"subplus", "\xE2\xAA\xBF"},
+				{"subrarr", "\xE2\xA5\xB9"},
+				{"subset", "\xE2\x8A\x82"},
+				{"subseteq", "\xE2\x8A\x86"},
+				{"subseteqq", "\xE2\xAB\x85"},
+				{"subsetneq", "\xE2\x8A\x8A"},
+				{"subsetneqq", "\xE2\xAB\x8B"},
+				{"subsim", "\xE2\xAB\x87"},
+				{"subsub", "\xE2\xAB\x95"},
+				{"subsup", "\xE2\xAB\x93"},
+				{"succ", "\xE2\x89\xBB"},
+				{"succapprox", "\xE2\xAA\xB8"},
+				{"succcurlyeq", "\xE2\x89\xBD"},
+				{"succeq", "\xE2\xAA\xB0"},
+				{"succnapprox", "\xE2\xAA\xBA"},
+				{"succneqq", "\xE2\xAA\xB6"},
+				{"succnsim", "\xE2\x8B\xA9"},
+				{"succsim", "\xE2\x89\xBF"},
+				{"sum", "\xE2\x88\x91"},
+				{"sung", "\xE2\x99\xAA"},
+				{"sup", "\xE2\x8A\x83"},
+				{"sup1", "\xC2\xB9"},
+				{"sup2", "\xC2\xB2"},
+				{"sup3", "\xC2\xB3"},
+				{"supE", "\xE2\xAB\x86"},
+				{"supdot", "\xE2\xAA\xBE"},
+				{"supdsub", "\xE2\xAB\x98"},
+				{"supe", "\xE2\x8A\x87"},
+				{"supedot", "\xE2\xAB\x84"},
+				{"suphsol", "\xE2\x9F\x89"},
+				{"suphsub", "\xE2\xAB\x97"},
+				{"suplarr", "\xE2\xA5\xBB"},
+				{"supmult", "\xE2\xAB\x82"},
+				{"supnE", "\xE2\xAB\x8C"},
+				{"supne", "\xE2\x8A\x8B"},
+				{"supplus", "\xE2\xAB\x80"},
+				{"supset", "\xE2\x8A\x83"},
+				{"supseteq", "\xE2\x8A\x87"},
+				{"supseteqq", "\xE2\xAB\x86"},
+				{"supsetneq", "\xE2\x8A\x8B"},
+				{"supsetneqq", "\xE2\xAB\x8C"},
+				{"supsim", "\xE2\xAB\x88"},
+				{"supsub", "\xE2\xAB\x94"},
+				{"supsup", "\xE2\xAB\x96"},
+				{"swArr", "\xE2\x87\x99"},
+				{"swarhk", "\xE2\xA4\xA6"},
+				{"swarr", "\xE2\x86\x99"},
+				{"swarrow", "\xE2\x86\x99"},
+				{"swnwar", "\xE2\xA4\xAA"},
+				{"szlig", "\xC3\x9F"},
+				{"target", "\xE2\x8C\x96"},
+				{"tau", "\xCF\x84"},
+				{"tbrk", "\xE2\x8E\xB4"},
+				{"tcaron", "\xC5\xA5"},
+				{"tcedil", "\xC5\xA3"},
+				{"tcy", "\xD1\x82"},
+				{"tdot", "\xE2\x83\x9B"},
+				{"telrec", "\xE2\x8C\x95"},
+				{"tfr", "\xF0\x9D\x94\xB1"},
+				{"there4", "\xE2\x88\xB4"},
+				{"therefore", "\xE2\x88\xB4"},
+				{"theta", "\xCE\xB8"},
+				{"thetasym", "\xCF\x91"},
+				{"thetav", "\xCF\x91"},
+				{"thickapprox", "\xE2\x89\x88"},
+				{"thicksim", "\xE2\x88\xBC"},
+				{"thinsp", "\xE2\x80\x89"},
+				{"thkap", "\xE2\x89\x88"},
+				{"thksim", "\xE2\x88\xBC"},
+				{"thorn", "\xC3\xBE"},
+				{"tilde", "\xCB\x9C"},
+				{"times", "\xC3\x97"},
+				{"timesb", "\xE2\x8A\xA0"},
+				{"timesbar", "\xE2\xA8\xB1"},
+				{"timesd", "\xE2\xA8\xB0"},
+				{"tint", "\xE2\x88\xAD"},
+				{"toea", "\xE2\xA4\xA8"},
+				{"top", "\xE2\x8A\xA4"},
+				{"topbot", "\xE2\x8C\xB6"},
+				{"topcir", "\xE2\xAB\xB1"},
+				{"topf", "\xF0\x9D\x95\xA5"},
+				{"topfork", "\xE2\xAB\x9A"},
+				{"tosa", "\xE2\xA4\xA9"},
+				{"tprime", "\xE2\x80\xB4"},
+				{"trade", "\xE2\x84\xA2"},
+				{"triangle", "\xE2\x96\xB5"},
+				{"triangledown", "\xE2\x96\xBF"},
+				{"triangleleft", "\xE2\x97\x83"},
+				{"trianglelefteq", "\xE2\x8A\xB4"},
+				{"triangleq", "\xE2\x89\x9C"},
+				{"triangleright", "\xE2\x96\xB9"},
+				{"trianglerighteq", "\xE2\x8A\xB5"},
+				{"tridot", "\xE2\x97\xAC"},
+				{"trie", "\xE2\x89\x9C"},
+				{"triminus", "\xE2\xA8\xBA"},
+				{"triplus", "\xE2\xA8\xB9"},
+				{"trisb", "\xE2\xA7\x8D"},
+				{"tritime", "\xE2\xA8\xBB"},
+				{"trpezium", "\xE2\x8F\xA2"},
+				{"tscr", "\xF0\x9D\x93\x89"},
+				{"tscy", "\xD1\x86"},
+				{"tshcy", "\xD1\x9B"},
+				{"tstrok", "\xC5\xA7"},
+				{"twixt", "\xE2\x89\xAC"},
+				{"twoheadleftarrow", "\xE2\x86\x9E"},
+				{"twoheadrightarrow", "\xE2\x86\xA0"},
+				{"uArr", "\xE2\x87\x91"},
+				{"uHar", "\xE2\xA5\xA3"},
+				{"uacute", "\xC3\xBA"},
+				{"uarr", "\xE2\x86\x91"},
+				{"ubrcy", "\xD1\x9E"},
+				{"ubreve", "\xC5\xAD"},
+				{"ucirc", "\xC3\xBB"},
+				{"ucy", "\xD1\x83"},
+				{"udarr", "\xE2\x87\x85"},
+				{"udblac", "\xC5\xB1"},
+				{"udhar", "\xE2\xA5\xAE"},
+				{"ufisht", "\xE2\xA5\xBE"},
+				{"ufr", "\xF0\x9D\x94\xB2"},
+				{"ugrave", "\xC3\xB9"},
+				{"uharl", "\xE2\x86\xBF"},
+				{"uharr", "\xE2\x86\xBE"},
+				{"uhblk", "\xE2\x96\x80"},
+				{"ulcorn", "\xE2\x8C\x9C"},
+				{"ulcorner", "\xE2\x8C\x9C"},
+				{"ulcrop", "\xE2\x8C\x8F"},
+				{"ultri", "\xE2\x97\xB8"},
+				{"umacr", "\xC5\xAB"},
+				{"uml", "\xC2\xA8"},
+				{"uogon", "\xC5\xB3"},
+				{"uopf", "\xF0\x9D\x95\xA6"},
+				{"uparrow", "\xE2\x86\x91"},
+				{"updownarrow", "\xE2\x86\x95"},
+				{"upharpoonleft", "\xE2\x86\xBF"},
+				{"upharpoonright", "\xE2\x86\xBE"},
+				{"uplus", "\xE2\x8A\x8E"},
+				{"upsi", "\xCF\x85"},
+				{"upsih", "\xCF\x92"},
+				{"upsilon", "\xCF\x85"},
+				{"upuparrows", "\xE2\x87\x88"},
+				{"urcorn", "\xE2\x8C\x9D"},
+				{"urcorner", "\xE2\x8C\x9D"},
+				{"urcrop", "\xE2\x8C\x8E"},
+				{"uring", "\xC5\xAF"},
+				{"urtri", "\xE2\x97\xB9"},
+				{"uscr", "\xF0\x9D\x93\x8A"},
+				{"utdot", "\xE2\x8B\xB0"},
+				{"utilde", "\xC5\xA9"},
+				{"utri", "\xE2\x96\xB5"},
+				{"utrif", "\xE2\x96\xB4"},
+				{"uuarr", "\xE2\x87\x88"},
+				{"uuml", "\xC3\xBC"},
+				{"uwangle", "\xE2\xA6\xA7"},
+				{"vArr", "\xE2\x87\x95"},
+				{"vBar", "\xE2\xAB\xA8"},
+				{"vBarv", "\xE2\xAB\xA9"},
+				{"vDash", "\xE2\x8A\xA8"},
+				{"vangrt", "\xE2\xA6\x9C"},
+				{"varepsilon", "\xCF\xB5"},
+				{"varkappa", "\xCF\xB0"},
+				{"varnothing", "\xE2\x88\x85"},
+				{"varphi", "\xCF\x95"},
+				{"varpi", "\xCF\x96"},
+				{"varpropto", "\xE2\x88\x9D"},
+				{"varr", "\xE2\x86\x95"},
+				{"varrho", "\xCF\xB1"},
+				{"varsigma", "\xCF\x82"},
+				{"varsubsetneq", "\xE2\x8A\x8A\xEF\xB8\x80"},
+				{"varsubsetneqq", "\xE2\xAB\x8B\xEF\xB8\x80"},
+				{"varsupsetneq", "\xE2\x8A\x8B\xEF\xB8\x80"},
+				{"varsupsetneqq", "\xE2\xAB\x8C\xEF\xB8\x80"},
+				{"vartheta", "\xCF\x91"},
+				{"vartriangleleft", "\xE2\x8A\xB2"},
+				{"vartriangleright", "\xE2\x8A\xB3"},
+				{"vcy", "\xD0\xB2"},
+				{"vdash", "\xE2\x8A\xA2"},
+				{"vee", "\xE2\x88\xA8"},
+				{"veebar", "\xE2\x8A\xBB"},
+				{"veeeq", "\xE2\x89\x9A"},
+				{"vellip", "\xE2\x8B\xAE"},
+				{"verbar", "|"},
+				{"vert", "|"},
+				{"vfr", "\xF0\x9D\x94\xB3"},
+				{"vltri", "\xE2\x8A\xB2"},
+				{"vnsub", "\xE2\x8A\x82\xE2\x83\x92"},
+				{"vnsup", "\xE2\x8A\x83\xE2\x83\x92"},
+				{"vopf", "\xF0\x9D\x95\xA7"},
+				{"vprop", "\xE2\x88\x9D"},
+				{"vrtri", "\xE2\x8A\xB3"},
+				{"vscr", "\xF0\x9D\x93\x8B"},
+				{"vsubnE", "\xE2\xAB\x8B\xEF\xB8\x80"},
+				{"vsubne", "\xE2\x8A\x8A\xEF\xB8\x80"},
+				{"vsupnE", "\xE2\xAB\x8C\xEF\xB8\x80"},
+				{"vsupne", "\xE2\x8A\x8B\xEF\xB8\x80"},
+				{"vzigzag", "\xE2\xA6\x9A"},
+				{"wcirc", "\xC5\xB5"},
+				{"wedbar", "\xE2\xA9\x9F"},
+				{"wedge", "\xE2\x88\xA7"},
+				{"wedgeq", "\xE2\x89\x99"},
+				{"weierp", "\xE2\x84\x98"},
+				{"wfr", "\xF0\x9D\x94\xB4"},
+				{"wopf", "\xF0\x9D\x95\xA8"},
+				{"wp", "\xE2\x84\x98"},
+				{"wr", "\xE2\x89\x80"},
+				{"wreath", "\xE2\x89\x80"},
+				{"wscr", "\xF0\x9D\x93\x8C"},
+				{"xcap", "\xE2\x8B\x82"},
+				{"xcirc", "\xE2\x97\xAF"},
+				{"xcup", "\xE2\x8B\x83"},
+				{"xdtri", "\xE2\x96\xBD"},
+				{"xfr", "\xF0\x9D\x94\xB5"},
+				{"xhArr", "\xE2\x9F\xBA"},
+				{"xharr", "\xE2\x9F\xB7"},
+				{"xi", "\xCE\xBE"},
+				{"xlArr", "\xE2\x9F\xB8"},
+				{"xlarr", "\xE2\x9F\xB5"},
+				{"xmap", "\xE2\x9F\xBC"},
+				{"xnis", "\xE2\x8B\xBB"},
+				{"xodot", "\xE2\xA8\x80"},
+				{"xopf", "\xF0\x9D\x95\xA9"},
+				{"xoplus", "\xE2\xA8\x81"},
+				{"xotime", "\xE2\xA8\x82"},
+				{"xrArr", "\xE2\x9F\xB9"},
+				{"xrarr", "\xE2\x9F\xB6"},
+				{"xscr", "\xF0\x9D\x93\x8D"},
+				{"xsqcup", "\xE2\xA8\x86"},
+				{"xuplus", "\xE2\xA8\x84"},
+				{"xutri", "\xE2\x96\xB3"},
+				{"xvee", "\xE2\x8B\x81"},
+				{"xwedge", "\xE2\x8B\x80"},
+				{"yacute", "\xC3\xBD"},
+				{"yacy", "\xD1\x8F"},
+				{"ycirc", "\xC5\xB7"},
+				{"ycy", "\xD1\x8B"},
+				{"yen", "\xC2\xA5"},
+				{"yfr", "\xF0\x9D\x94\xB6"},
+				{"yicy", "\xD1\x97"},
+				{"yopf", "\xF0\x9D\x95\xAA"},
+				{"yscr", "\xF0\x9D\x93\x8E"},
+				{"yucy", "\xD1\x8E"},
+				{"yuml", "\xC3\xBF"},
+				{"zacute", "\xC5\xBA"},
+				{"zcaron", "\xC5\xBE"},
+				{"zcy", "\xD0\xB7"},
+				{"zdot", "\xC5\xBC"},
+				{"zeetrf", "\xE2\x84\xA8"},
+				{"zeta", "\xCE\xB6"},
+				{"zfr", "\xF0\x9D\x94\xB7"},
+				{"zhcy", "\xD0\xB6"},
+				{"zigrarr", "\xE2\x87\x9D"},
+				{"zopf", "\xF0\x9D\x95\xAB"},
+				{"zscr", "\xF0\x9D\x93\x8F"},
+				{"zwj", "\xE2\x80\x8D"},
+				{"zwnj", "\xE2\x80\x8C"},
+			};
+			static constexpr std::size_t entity_bucket_count = 1024;
+			static constexpr std::size_t entity_slot_count = 4096;
+			// The seed for each bucket, which moves every name in the bucket to its own slot.
+			static constexpr std::uint16_t entity_displacements[entity_bucket_count] = {
+				1, 1, 2, 1, 0, 1, 1, 1, 4, 1, 1, 1, 5, 1, 0, 6, 1, 1, 1, 5, 1, 0, 1, 1, 1, 4, 1, 0, 2, 1, 9, 2,
+				1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 1, 1, 2, 6, 1, 2, 0, 2, 4, 0, 1, 4, 1, 4, 1, 4, 6, 2, 0, 1, 1, 1,
+				1, 1, 0, 6, 2, 2, 0, 1, 1, 1, 1, 2, 1, 0, 0, 2, 1, 2, 2, 1, 1, 3, 1, 0, 1, 1, 4, 1, 1, 8, 4, 3,
+				2, 1, 2, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 2, 3, 0, 3, 3, 1, 5, 1, 1, 0, 1, 1, 2, 1, 1, 1, 2, 1, 1,
+				1, 1, 1, 1, 1, 0, 1, 2, 1, 1, 0, 2, 1, 0, 2, 2, 1, 1, 4, 6, 1, 2, 3, 1, 3, 1, 2, 2, 1, 0, 2, 0,
+				1, 1, 1, 2, 2, 0, 4, 1, 5, 1, 5, 3, 1, 3, 1, 0, 1, 0, 1, 0, 1, 2, 6, 1, 1, 0, 1, 3, 3, 2, 2, 3,
+				1, 3, 0, 1, 1, 3, 1, 2, 2, 1, 1, 3, 1, 3, 0, 2, 3, 5, 1, 2, 1, 3, 2, 3, 3, 3, 1, 1, 2, 0, 5, 4,
+				2, 1, 2, 0, 3, 1, 1, 2, 1, 3, 1, 5, 1, 3, 1, 4, 1, 1, 2, 3, 1, 2, 9, 1, 0, 4, 1, 1, 2, 1, 1, 1,
+				1, 0, 2, 1, 5, 5, 1, 1, 1, 1, 5, 2, 1, 0, 1, 0, 1, 0, 1, 1, 7, 2, 2, 1, 1, 3, 6, 1, 0, 2, 1, 1,
+				3, 0, 1, 1, 1, 3, 1, 2, 1, 1, 1, 1, 3, 2, 2, 4, 2, 3, 2, 2, 1, 3, 0, 1, 5, 1, 5, 1, 1, 2, 3, 8,
+				2, 5, 2, 0, 0, 1, 1, 1, 2, 4, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 2, 3, 1, 3, 0, 1, 1, 1, 2, 0, 2,
+				0, 2, 3, 0, 2, 3, 2, 1, 0, 1, 1, 4, 1, 0, 1, 0, 1, 0, 4, 1, 0, 7, 3, 1, 1, 0, 1, 1, 2, 1, 5, 2,
+				2, 3, 1, 1, 1, 1, 3, 3, 1, 1, 4, 2, 1, 2, 2, 1, 1, 4, 4, 2, 1, 2, 0, 1, 6, 3, 1, 1, 1, 2, 2, 0,
+				4, 2, 1, 0, 1, 1, 1, 1, 1, 8, 2, 4, 2, 1, 2, 0, 1, 3, 0, 1, 0, 1, 1, 1, 1, 1, 6, 0, 2, 2, 3, 1,
+				1, 0, 1, 2, 0, 0, 3, 2, 0, 1, 3, 1, 1, 2, 1, 1, 0, 2, 0, 0, 3, 5, 1, 5, 2, 1, 4, 0, 1, 1, 1, 1,
+				4, 1, 1, 1, 0, 0, 1, 4, 4, 2, 2, 5, 1, 1, 5, 2, 0, 1, 1, 1, 4, 1, 5, 0, 0, 1, 0, 2, 1, 1, 2, 3,
+				1, 1, 3, 0, 1, 3, 5, 7, 4, 1, 0, 1, 1, 1, 0, 1, 2, 2, 0, 2, 7, 3, 3, 1, 1, 1, 2, 1, 4, 1, 1, 2,
+				1, 1, 0, 4, 1, 2, 1, 3, 2, 1, 6, 0, 2, 2, 2, 1, 4, 1, 1, 2, 2, 4, 0, 4, 1, 1, 1, 3, 0, 2, 1, 1,
+				1, 1, 2, 0, 6, 5, 2, 0, 3, 0, 1, 8, 0, 1, 1, 1, 1, 4, 2, 4, 2, 2, 2, 2, 2, 3, 0, 1, 1, 1, 1, 3,
+				1, 2, 1, 1, 1, 0, 1, 1, 1, 3, 2, 2, 3, 0, 1, 0, 1, 1, 2, 2, 1, 2, 1, 0, 0, 2, 7, 8, 2, 1, 1, 5,
+				1, 1, 6, 1, 1, 1, 1, 4, 1, 0, 2, 2, 3, 3, 7, 1, 4, 2, 2, 2, 2, 0, 2, 1, 2, 1, 1, 4, 1, 0, 1, 1,
+				2, 2, 6, 1, 2, 1, 1, 3, 4, 5, 1, 2, 1, 0, 1, 5, 5, 5, 1, 6, 1, 3, 4, 1, 3, 1, 0, 1, 1, 1, 10, 4,
+				1, 1, 1, 2, 3, 1, 1, 1, 0, 7, 0, 4, 1, 1, 1, 1, 1, 0, 1, 0, 7, 2, 1, 1, 8, 1, 11, 1, 2, 2, 1, 4,
+				2, 1, 3, 7, 3, 1, 0, 3, 8, 0, 1, 6, 1, 2, 1, 4, 1, 3, 2, 6, 4, 1, 4, 1, 0, 0, 2, 1, 7, 0, 3, 0,
+				0, 1, 3, 1, 0, 1, 1, 1, 3, 2, 0, 2, 3, 1, 8, 1, 1, 0, 2, 3, 0, 0, 1, 2, 8, 2, 1, 1, 4, 5, 4, 1,
+				9, 0, 1, 1, 1, 1, 0, 2, 3, 1, 3, 3, 2, 4, 4, 2, 4, 0, 0, 2, 0, 1, 1, 6, 1, 3, 0, 3, 1, 4, 3, 8,
+				5, 0, 1, 3, 1, 1, 2, 2, 1, 2, 2, 3, 1, 0, 4, 1, 4, 1, 1, 1, 1, 1, 0, 1, 2, 5, 1, 1, 1, 0, 3, 2,
+				1, 1, 5, 2, 1, 4, 1, 4, 6, 3, 2, 1, 1, 3, 1, 1, 2, 1, 2, 4, 2, 4, 2, 0, 1, 1, 5, 1, 2, 1, 2, 1,
+				1, 1, 1, 1, 1, 2, 1, 7, 1, 1, 1, 2, 1, 1, 0, 1, 1, 5, 1, 2, 7, 3, 3, 1, 1, 1, 1, 1, 1, 1, 7, 1,
+				2, 1, 2, 1, 2, 7, 8, 3, 0, 2, 1, 2, 0, 1, 0, 1, 1, 2, 5, 8, 1, 4, 1, 0, 2, 2, 3, 3, 1, 3, 2, 3,
+				8, 2, 5, 1, 8, 1, 0, 2, 4, 11, 1, 1, 5, 2, 1, 2, 1, 2, 5, 1, 0, 1, 2, 6, 3, 1, 1, 1, 1, 0, 1, 1,
+				3, 0, 1, 6, 2, 1, 2, 3, 5, 1, 2, 1, 13, 2, 1, 1, 1, 7, 1, 2, 2, 1, 1, 1, 2, 10, 1, 2, 3, 3, 1, 2,
+			};
+			// index+1 into named_entities, or 0 if empty
+			static constexpr std::uint16_t entity_slots[entity_slot_count] = {
+				1964, 0, 0, 0, 0, 344, 993, 2026, 569, 0, 0, 1703, 0, 1921, 0, 0, 994, 343, 0, 1881, 0, 598, 951, 1878, 198, 1984, 0, 859, 1788, 963, 1742, 0,
+				700, 499, 1198, 634, 0, 0, 0, 1657, 0, 1507, 0, 0, 0, 1762, 0, 640, 30, 0, 0, 1537, 667, 1669, 777, 0, 0, 0, 0, 1449, 29, 0, 0, 0,
+				0, 984, 0, 0, 0, 1203, 0, 2123, 1315, 1970, 915, 371, 421, 0, 0, 998, 0, 0, 971, 1401, 704, 1560, 58, 1181, 1179, 0, 394, 0, 0, 1047, 0, 0,
+				0, 1814, 900, 1033, 78, 1026, 0, 1147, 1394, 753, 0, 0, 1292, 0, 381, 1920, 0, 1281, 1973, 1233, 776, 0, 0, 2047, 919, 31, 1988, 0, 0, 0, 0, 808,
+				0, 101, 1027, 0, 731, 0, 0, 0, 1254, 0, 0, 440, 0, 0, 1664, 0, 0, 1682, 0, 0, 1354, 318, 1738, 2113, 596, 1725, 1237, 154, 0, 181, 0, 1685,
+				103, 0, 0, 1086, 945, 0, 661, 349, 702, 287, 187, 157, 1454, 1314, 967, 0, 0, 0, 1327, 0, 0, 786, 0, 88, 0, 0, 824, 749, 0, 0, 935, 789,
+				1132, 1532, 578, 2000, 0, 0, 339, 1621, 0, 0, 137, 827, 1559, 0, 0, 522, 347, 0, 0, 0, 0, 2096, 1555, 0, 609, 0, 0, 1213, 626, 0, 53, 1501,
+				1936, 0, 0, 1996, 0, 2078, 996, 0, 455, 0, 0, 0, 0, 807, 653, 1825, 8, 0, 0, 2058, 0, 0, 97, 0, 0, 0, 0, 1670, 889, 0, 0, 1340,
+				1775, 1015, 0, 995, 944, 1826, 79, 0, 0, 1489, 1998, 306, 1684, 914, 0, 0, 239, 1351, 0, 0, 1285, 0, 234, 1865, 691, 1524, 1880, 0, 1817, 0, 0, 1009,
+				1579, 1088, 183, 1258, 0, 1994, 1341, 533, 0, 1505, 899, 215, 0, 346, 1906, 764, 0, 651, 0, 1480, 0, 0, 0, 0, 0, 0, 0, 1188, 1172, 1619, 0, 0,
+				1487, 570, 0, 654, 0, 2046, 1159, 583, 0, 1465, 0, 0, 182, 1226, 1793, 71, 0, 0, 1797, 0, 710, 1102, 0, 0, 1539, 0, 0, 0, 0, 1513, 1025, 1046,
+				204, 773, 0, 0, 0, 1288, 0, 0, 1526, 0, 0, 0, 0, 1387, 1316, 0, 2072, 0, 386, 852, 0, 1121, 0, 1018, 1901, 0, 0, 0, 1320, 0, 0, 335,
+				0, 1412, 2066, 1622, 439, 1140, 2119, 1138, 1183, 255, 660, 639, 1810, 646, 689, 0, 1862, 566, 0, 1977, 278, 1625, 1100, 0, 1755, 0, 158, 1486, 0, 0, 0, 2075,
+				34, 1382, 0, 1455, 1193, 822, 0, 1094, 0, 0, 1809, 0, 1368, 0, 288, 0, 1899, 470, 0, 703, 87, 0, 0, 2027, 231, 0, 1144, 0, 167, 334, 1834, 0,
+				0, 0, 0, 707, 51, 1515, 1073, 0, 263, 0, 0, 0, 0, 0, 142, 0, 0, 0, 1064, 0, 1157, 150, 210, 0, 0, 0, 297, 882, 582, 0, 0, 1704,
+				1407, 1422, 1071, 814, 0, 2013, 0, 0, 0, 0, 486, 0, 1116, 0, 410, 0, 1690, 1361, 0, 0, 269, 0, 755, 1448, 925, 404, 0, 1204, 0, 0, 291, 823,
+				365, 0, 1739, 0, 1234, 902, 0, 0, 0, 0, 0, 0, 1135, 0, 0, 602, 1363, 0, 745, 1109, 0, 1829, 251, 1356, 1632, 1758, 987, 0, 1321, 0, 0, 135,
+				0, 0, 0, 0, 419, 0, 0, 0, 0, 809, 0, 1043, 0, 0, 220, 678, 0, 504, 0, 0, 1488, 0, 0, 0, 733, 316, 2106, 0, 810, 516, 1534, 1953,
+				840, 0, 1170, 641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1729, 576, 536, 106, 1550, 1263, 0, 1036, 0, 1190, 1732, 0, 1947, 33, 800, 13,
+				1035, 310, 621, 0, 692, 0, 1404, 644, 45, 0, 0, 295, 54, 0, 790, 557, 0, 224, 1562, 0, 0, 366, 0, 2101, 0, 401, 1101, 868, 0, 1079, 0, 0,
+				1250, 0, 841, 1616, 433, 0, 0, 2015, 620, 0, 1716, 427, 0, 1493, 2077, 0, 975, 0, 312, 0, 1001, 812, 0, 775, 1323, 0, 1469, 0, 766, 0, 0, 0,
+				0, 525, 1864, 0, 0, 0, 92, 0, 1466, 1856, 0, 0, 476, 1581, 0, 0, 0, 0, 0, 1575, 246, 0, 0, 1651, 1282, 0, 1182, 1960, 0, 148, 0, 1602,
+				0, 0, 956, 0, 0, 0, 0, 130, 1756, 491, 0, 184, 0, 0, 0, 0, 898, 1661, 0, 0, 0, 0, 1308, 940, 0, 385, 916, 0, 0, 1974, 0, 921,
+				0, 1909, 0, 0, 728, 1417, 1535, 1698, 197, 0, 0, 0, 0, 358, 538, 0, 1981, 126, 0, 0, 206, 68, 647, 0, 0, 1741, 0, 1659, 465, 0, 0, 1494,
+				0, 0, 2083, 359, 0, 9, 0, 448, 0, 0, 0, 1059, 0, 0, 0, 1107, 1427, 2085, 1336, 1718, 1721, 488, 606, 0, 0, 1218, 1672, 989, 0, 0, 0, 441,
+				0, 0, 1166, 0, 0, 1640, 0, 0, 0, 909, 2086, 0, 0, 0, 876, 0, 60, 39, 0, 0, 0, 0, 1802, 276, 0, 0, 1452, 0, 1823, 0, 0, 0,
+				72, 828, 901, 0, 517, 0, 835, 1594, 0, 891, 0, 223, 0, 838, 0, 267, 0, 0, 0, 44, 0, 0, 942, 1167, 1957, 0, 0, 1606, 752, 1479, 0, 966,
+				1638, 0, 1239, 1567, 1393, 319, 1853, 0, 0, 0, 1724, 341, 874, 398, 0, 0, 701, 1766, 0, 1668, 1955, 2002, 73, 0, 0, 0, 1636, 416, 2095, 127, 0, 0,
+				0, 1146, 1410, 0, 0, 0, 1961, 0, 1219, 1709, 1855, 0, 282, 0, 0, 0, 0, 0, 0, 1177, 114, 0, 1673, 1556, 1528, 675, 1491, 0, 1740, 1223, 2055, 0,
+				1279, 0, 0, 911, 2107, 256, 0, 650, 1168, 156, 1095, 1891, 1441, 0, 0, 0, 0, 1916, 1692, 1304, 1935, 0, 628, 0, 0, 1119, 839, 0, 0, 0, 544, 0,
+				0, 979, 0, 0, 0, 600, 736, 1852, 1530, 1504, 601, 0, 762, 0, 645, 117, 121, 1065, 526, 0, 534, 374, 0, 0, 1656, 1502, 0, 0, 0, 1087, 1995, 0,
+				2029, 0, 160, 0, 1130, 329, 521, 0, 0, 0, 0, 0, 1892, 345, 383, 0, 756, 248, 301, 1482, 155, 0, 0, 1776, 0, 1753, 0, 0, 502, 392, 1390, 407,
+				1160, 0, 0, 1858, 1686, 1943, 0, 1175, 411, 976, 893, 483, 0, 0, 0, 451, 0, 917, 1937, 0, 1149, 493, 0, 0, 0, 426, 590, 1205, 1498, 1054, 571, 194,
+				0, 1601, 0, 0, 1518, 249, 0, 236, 850, 123, 0, 2120, 0, 1578, 0, 259, 0, 0, 2042, 0, 1822, 1241, 2018, 0, 1435, 0, 0, 0, 0, 577, 0, 1678,
+				0, 0, 0, 0, 0, 0, 1022, 230, 1221, 597, 252, 1617, 1197, 0, 0, 856, 0, 0, 0, 2054, 1396, 0, 0, 1391, 922, 949, 338, 1346, 1303, 0, 1691, 0,
+				0, 0, 0, 1699, 1243, 1792, 1694, 587, 0, 0, 0, 1688, 607, 0, 1576, 906, 1511, 52, 1735, 0, 250, 0, 0, 511, 0, 1076, 671, 0, 0, 0, 0, 1299,
+				0, 0, 663, 1418, 0, 1044, 769, 119, 0, 1113, 0, 375, 0, 0, 1885, 0, 1679, 0, 0, 0, 1413, 0, 0, 0, 0, 271, 0, 1623, 1674, 0, 145, 0,
+				0, 1637, 0, 320, 1971, 0, 1771, 0, 729, 1662, 0, 1509, 171, 0, 0, 1442, 1757, 1039, 1807, 1400, 720, 0, 0, 1313, 0, 847, 816, 0, 1011, 0, 0, 10,
+				0, 373, 0, 1890, 369, 896, 233, 0, 0, 0, 0, 495, 1969, 0, 1905, 1057, 0, 1050, 1596, 481, 767, 1627, 1580, 527, 1301, 0, 0, 0, 279, 0, 961, 0,
+				270, 603, 0, 0, 193, 531, 0, 237, 659, 0, 0, 0, 0, 0, 988, 1945, 593, 0, 0, 0, 0, 716, 0, 0, 1074, 166, 0, 0, 1838, 0, 0, 0,
+				1265, 1785, 718, 268, 0, 1311, 453, 0, 688, 697, 67, 201, 506, 302, 0, 0, 0, 1383, 0, 128, 1786, 0, 806, 0, 1746, 0, 588, 0, 1344, 0, 0, 866,
+				0, 2043, 1631, 0, 888, 0, 265, 1142, 0, 0, 972, 0, 1267, 1827, 0, 0, 833, 0, 0, 1951, 0, 0, 1045, 0, 0, 0, 1437, 0, 739, 253, 1472, 0,
+				699, 1444, 829, 0, 1536, 0, 1772, 492, 258, 0, 1646, 0, 0, 1586, 1635, 227, 1114, 0, 0, 1789, 0, 0, 0, 0, 955, 0, 1542, 713, 257, 709, 2088, 294,
+				0, 0, 0, 57, 0, 1874, 1333, 0, 0, 2035, 0, 0, 0, 90, 1492, 1232, 929, 1987, 0, 0, 1171, 1763, 0, 1318, 245, 0, 1929, 2011, 0, 564, 0, 0,
+				0, 1997, 0, 0, 0, 1457, 1173, 0, 0, 0, 0, 40, 927, 0, 0, 732, 0, 0, 2111, 24, 75, 0, 1048, 0, 0, 1980, 64, 872, 0, 2067, 0, 431,
+				1712, 813, 0, 0, 0, 2082, 1680, 0, 788, 0, 1782, 1430, 985, 723, 0, 2109, 0, 0, 819, 0, 478, 0, 1490, 1380, 2084, 0, 0, 1136, 1655, 0, 1131, 0,
+				0, 0, 186, 613, 2007, 959, 0, 1129, 1406, 1895, 0, 0, 0, 1736, 754, 830, 787, 778, 1811, 0, 0, 0, 1478, 0, 1499, 1600, 0, 0, 1268, 446, 1883, 138,
+				0, 662, 0, 354, 0, 0, 0, 0, 0, 2117, 690, 0, 1972, 559, 0, 37, 0, 0, 543, 1220, 0, 0, 0, 1072, 530, 0, 0, 982, 0, 84, 1256, 1620,
+				0, 0, 1875, 0, 0, 0, 0, 0, 1276, 1675, 860, 1749, 618, 694, 2064, 0, 1117, 0, 0, 726, 1876, 2040, 0, 1708, 1375, 1191, 326, 0, 0, 0, 0, 0,
+				0, 0, 1202, 0, 405, 0, 214, 869, 1366, 0, 0, 0, 0, 0, 864, 1700, 304, 815, 96, 783, 924, 1397, 1264, 0, 0, 0, 0, 0, 1325, 0, 0, 0,
+				1298, 1796, 0, 0, 0, 0, 548, 487, 1037, 0, 0, 0, 958, 0, 0, 0, 356, 952, 147, 0, 761, 140, 1954, 722, 0, 1291, 141, 2032, 0, 630, 0, 1089,
+				0, 0, 108, 1872, 1734, 1751, 1790, 669, 0, 0, 1215, 1459, 877, 0, 627, 0, 0, 677, 429, 863, 0, 0, 298, 594, 0, 0, 1706, 1922, 12, 0, 0, 664,
+				409, 0, 1545, 1199, 0, 553, 479, 928, 0, 1915, 1879, 2024, 0, 1754, 0, 625, 0, 0, 432, 0, 0, 0, 1557, 0, 0, 0, 1331, 1029, 1570, 0, 973, 0,
+				0, 1717, 1041, 0, 1270, 1663, 0, 0, 0, 0, 0, 0, 2125, 0, 0, 0, 1516, 1145, 2023, 0, 0, 0, 180, 1727, 0, 2051, 0, 0, 791, 0, 1176, 1764,
+				143, 1075, 1273, 1540, 89, 0, 589, 1317, 657, 174, 454, 0, 1475, 136, 0, 0, 1038, 0, 2094, 1155, 1127, 0, 281, 0, 0, 0, 2116, 0, 871, 272, 208, 0,
+				2003, 1769, 1552, 535, 1278, 0, 0, 0, 983, 0, 1843, 2121, 430, 243, 948, 1162, 0, 2034, 0, 0, 0, 0, 638, 0, 0, 1414, 0, 1720, 574, 0, 0, 324,
+				1514, 498, 0, 489, 0, 0, 0, 175, 0, 1096, 680, 1962, 0, 1648, 1990, 831, 0, 457, 0, 0, 0, 714, 0, 0, 2102, 0, 2045, 681, 0, 1423, 0, 0,
+				0, 0, 0, 1063, 0, 2093, 0, 0, 0, 0, 0, 0, 1939, 0, 0, 920, 0, 730, 1618, 986, 0, 977, 0, 0, 0, 1187, 500, 2081, 0, 83, 943, 0,
+				0, 1525, 1522, 165, 1211, 867, 711, 1058, 0, 0, 66, 0, 435, 1365, 2021, 0, 0, 0, 0, 1908, 286, 185, 0, 0, 696, 1403, 1118, 2038, 0, 235, 0, 0,
+				0, 0, 0, 0, 1222, 0, 2001, 0, 211, 0, 0, 1070, 1563, 0, 395, 0, 0, 0, 0, 0, 423, 0, 0, 0, 1206, 0, 0, 382, 238, 0, 0, 0,
+				0, 1840, 367, 0, 1216, 0, 0, 134, 0, 0, 0, 0, 0, 0, 244, 1592, 1461, 0, 1689, 0, 1863, 0, 1310, 124, 0, 584, 0, 1151, 412, 0, 289, 0,
+				1695, 225, 1297, 0, 0, 0, 1051, 793, 1968, 0, 1982, 0, 540, 417, 496, 0, 2118, 348, 0, 11, 0, 1257, 0, 0, 0, 0, 817, 0, 0, 1017, 1677, 795,
+				360, 1293, 934, 1733, 0, 0, 22, 1812, 0, 1647, 0, 0, 1933, 907, 0, 399, 0, 1485, 41, 0, 1350, 2076, 0, 0, 782, 299, 0, 903, 0, 1839, 0, 0,
+				0, 0, 0, 0, 0, 370, 0, 727, 0, 0, 0, 1056, 7, 0, 1652, 0, 1910, 0, 953, 1261, 46, 1912, 1613, 0, 444, 0, 842, 0, 0, 2074, 1425, 209,
+				1713, 0, 1081, 0, 0, 0, 0, 887, 0, 1139, 541, 0, 0, 0, 875, 0, 0, 0, 1645, 0, 0, 99, 438, 1859, 1571, 0, 1566, 0, 743, 968, 0, 1068,
+				0, 1201, 242, 1332, 0, 0, 293, 1983, 0, 0, 1120, 1419, 47, 19, 757, 2039, 0, 0, 0, 74, 1778, 923, 744, 0, 0, 1416, 0, 100, 0, 164, 0, 1008,
+				560, 771, 648, 95, 0, 0, 1967, 1353, 1004, 0, 0, 799, 1192, 0, 978, 1137, 2033, 0, 1161, 0, 1904, 0, 1143, 0, 1564, 0, 384, 1529, 858, 0, 0, 471,
+				0, 0, 2036, 2056, 1367, 0, 0, 0, 619, 402, 0, 0, 1611, 0, 0, 192, 0, 228, 325, 266, 497, 1287, 0, 0, 0, 0, 0, 205, 1676, 779, 0, 0,
+				803, 0, 0, 0, 1090, 0, 0, 1584, 0, 0, 585, 2103, 941, 1007, 0, 1381, 999, 510, 0, 50, 0, 610, 0, 2052, 1309, 0, 1429, 0, 797, 0, 2, 0,
+				0, 0, 1902, 0, 514, 0, 314, 0, 0, 0, 0, 0, 1275, 1889, 0, 708, 656, 2115, 0, 1551, 0, 0, 5, 0, 721, 563, 1402, 2061, 0, 1791, 0, 0,
+				1643, 0, 0, 0, 1476, 1582, 0, 0, 0, 0, 623, 0, 668, 890, 1483, 1924, 0, 0, 0, 513, 0, 0, 139, 482, 1456, 0, 0, 0, 0, 1654, 1474, 1210,
+				0, 0, 0, 0, 1357, 0, 1080, 1574, 617, 0, 1156, 1249, 0, 0, 0, 0, 1849, 0, 954, 4, 1092, 848, 0, 0, 1728, 219, 0, 0, 76, 1302, 0, 0,
+				468, 0, 0, 65, 0, 322, 0, 0, 0, 0, 811, 554, 539, 0, 0, 0, 0, 635, 0, 0, 912, 1913, 747, 0, 0, 0, 443, 1105, 0, 1377, 0, 2019,
+				0, 0, 1928, 0, 0, 0, 1003, 1371, 936, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 881, 781, 1238, 768, 1523, 0, 0, 133, 0, 1850, 0, 1506,
+				0, 0, 229, 1869, 0, 0, 0, 751, 0, 0, 0, 845, 1468, 1122, 1888, 0, 0, 643, 0, 0, 0, 0, 48, 0, 389, 93, 1208, 878, 1750, 0, 149, 1431,
+				1443, 0, 1334, 0, 1097, 0, 0, 1992, 363, 0, 780, 1925, 611, 1783, 0, 1141, 0, 0, 676, 649, 0, 85, 0, 355, 1781, 0, 0, 21, 1595, 342, 1460, 153,
+				1952, 1941, 459, 558, 0, 0, 1374, 1260, 337, 0, 1040, 0, 1959, 0, 0, 283, 0, 309, 436, 1549, 981, 0, 0, 0, 0, 1938, 2068, 0, 260, 693, 1134, 1290,
+				0, 0, 2087, 0, 738, 351, 0, 91, 1615, 0, 1010, 0, 36, 26, 420, 0, 1948, 1591, 0, 247, 886, 1958, 1565, 0, 0, 614, 673, 1462, 0, 1572, 0, 1165,
+				0, 1438, 161, 1821, 0, 0, 1835, 449, 930, 0, 1, 0, 2063, 273, 0, 524, 0, 1794, 1546, 0, 937, 0, 177, 0, 0, 0, 883, 0, 0, 0, 612, 0,
+				0, 0, 0, 0, 0, 0, 2049, 0, 2114, 0, 1508, 746, 0, 408, 415, 784, 0, 0, 0, 202, 962, 0, 0, 0, 0, 0, 0, 0, 551, 331, 0, 2110,
+				0, 0, 1463, 1392, 969, 280, 2005, 0, 0, 1612, 1236, 0, 0, 568, 0, 1818, 1307, 785, 0, 873, 1378, 1335, 0, 1388, 0, 0, 505, 0, 0, 81, 1458, 1745,
+				0, 772, 0, 523, 0, 1907, 1705, 0, 111, 1153, 0, 0, 1093, 0, 328, 0, 1373, 0, 629, 908, 0, 0, 1355, 0, 0, 1866, 0, 340, 0, 1495, 0, 1800,
+				555, 1597, 0, 6, 0, 0, 1446, 592, 0, 0, 469, 2062, 1196, 0, 163, 0, 1078, 0, 1034, 1923, 0, 0, 1911, 0, 1768, 0, 0, 865, 43, 997, 18, 0,
+				0, 0, 0, 991, 1447, 0, 1599, 82, 595, 35, 1445, 2070, 1614, 0, 2041, 0, 195, 0, 0, 403, 1376, 379, 0, 462, 0, 665, 413, 152, 0, 0, 0, 1932,
+				549, 1245, 0, 0, 1453, 1300, 27, 0, 0, 0, 0, 586, 1085, 0, 0, 1608, 0, 1975, 1702, 853, 0, 765, 0, 1451, 1553, 0, 0, 1819, 686, 0, 330, 3,
+				0, 637, 0, 0, 0, 0, 0, 118, 0, 1240, 0, 0, 0, 0, 0, 277, 364, 380, 0, 1152, 0, 1115, 0, 2060, 0, 1860, 221, 910, 759, 1744, 0, 0,
+				1077, 0, 857, 1743, 1440, 0, 1229, 0, 0, 1731, 461, 129, 1069, 832, 1128, 572, 0, 0, 437, 1666, 0, 169, 0, 1255, 0, 0, 0, 1195, 0, 0, 2016, 0,
+				0, 0, 69, 0, 0, 0, 0, 0, 631, 1108, 0, 0, 580, 894, 0, 0, 0, 0, 0, 0, 0, 0, 1230, 0, 0, 932, 0, 0, 1272, 0, 1471, 173,
+				960, 0, 1324, 0, 0, 741, 0, 1244, 0, 0, 946, 107, 1099, 0, 0, 0, 0, 1372, 0, 0, 2105, 0, 1473, 624, 719, 362, 1667, 1133, 290, 0, 519, 0,
+				0, 1235, 1748, 0, 0, 0, 0, 1110, 1521, 0, 0, 546, 59, 1358, 0, 0, 0, 0, 0, 1841, 0, 38, 1813, 0, 0, 176, 0, 0, 0, 0, 837, 0,
+				0, 1944, 0, 132, 0, 0, 0, 0, 1660, 0, 2065, 0, 0, 0, 938, 0, 1759, 0, 1837, 274, 1942, 0, 2020, 0, 0, 679, 0, 0, 0, 1031, 1349, 0,
+				0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 1030, 652, 144, 836, 1946, 2008, 1231, 0, 0, 1795, 1024, 1547, 0, 0, 0, 1587, 0, 1364, 0, 0, 0, 0,
+				1798, 537, 1593, 0, 0, 1384, 1722, 0, 0, 0, 2092, 0, 2009, 1252, 1630, 240, 0, 1527, 0, 1765, 0, 0, 1963, 0, 179, 0, 734, 0, 0, 0, 1319, 1898,
+				0, 0, 0, 1541, 1590, 1021, 0, 447, 0, 0, 552, 0, 2124, 1714, 2010, 862, 0, 0, 391, 1644, 1671, 0, 725, 0, 0, 0, 0, 352, 94, 0, 1993, 1884,
+				1779, 0, 666, 1061, 0, 0, 122, 0, 0, 992, 805, 0, 0, 0, 0, 333, 0, 0, 0, 284, 0, 0, 1246, 974, 0, 2050, 0, 0, 655, 0, 0, 1251,
+				0, 2079, 0, 216, 0, 1399, 0, 1585, 422, 1247, 825, 0, 0, 0, 0, 1554, 1697, 0, 115, 350, 1339, 2017, 0, 698, 0, 0, 0, 0, 0, 0, 0, 1886,
+				0, 0, 0, 1824, 323, 0, 218, 2044, 2048, 683, 542, 0, 1605, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 735, 0, 0, 0, 0, 0, 885, 509,
+				826, 162, 1854, 0, 904, 742, 0, 1573, 0, 1991, 1711, 2071, 0, 706, 0, 760, 0, 1055, 1603, 1583, 1343, 2022, 0, 0, 950, 1497, 1421, 0, 456, 0, 484, 0,
+				849, 0, 0, 1836, 0, 1067, 1266, 1409, 1164, 63, 0, 0, 2053, 1966, 0, 0, 0, 0, 0, 1873, 0, 1411, 0, 0, 1042, 1544, 396, 0, 1212, 2122, 2080, 0,
+				0, 1370, 2014, 1607, 604, 1148, 1897, 0, 414, 1710, 884, 264, 1217, 0, 1415, 1184, 222, 0, 0, 2099, 1408, 1280, 1533, 579, 1386, 0, 0, 1286, 0, 0, 0, 834,
+				357, 0, 0, 0, 501, 151, 1777, 110, 1693, 0, 854, 0, 0, 0, 0, 0, 1588, 0, 1604, 1016, 0, 1385, 0, 1228, 0, 905, 0, 0, 918, 0, 1641, 425,
+				0, 0, 532, 512, 376, 1352, 855, 0, 957, 0, 241, 61, 0, 1084, 0, 573, 1816, 0, 695, 633, 0, 1767, 2104, 1543, 0, 1979, 0, 0, 1019, 0, 0, 913,
+				0, 0, 0, 0, 1496, 705, 0, 1020, 0, 0, 0, 0, 0, 0, 933, 473, 1598, 300, 1737, 1715, 0, 0, 870, 1787, 464, 308, 1306, 1820, 1927, 1887, 1395, 0,
+				0, 1053, 361, 892, 0, 0, 1531, 0, 1083, 0, 0, 0, 0, 796, 1568, 0, 475, 1389, 353, 1577, 406, 1815, 0, 820, 2059, 1639, 0, 292, 2090, 472, 77, 1719,
+				515, 0, 0, 467, 1362, 0, 0, 1723, 0, 0, 0, 980, 480, 397, 1294, 1548, 1428, 1262, 1900, 1326, 672, 0, 0, 0, 1845, 0, 0, 0, 80, 0, 0, 28,
+				0, 0, 1227, 1477, 964, 0, 0, 0, 1012, 254, 1106, 327, 0, 1861, 0, 0, 0, 0, 608, 0, 0, 758, 303, 1032, 0, 1894, 1830, 0, 146, 0, 1978, 336,
+				0, 1000, 0, 1066, 550, 62, 0, 1914, 296, 0, 2028, 0, 1503, 1398, 0, 0, 0, 0, 485, 1049, 0, 0, 1848, 0, 0, 0, 98, 1917, 0, 1023, 1844, 0,
+				0, 575, 200, 0, 190, 275, 724, 0, 0, 0, 387, 178, 0, 1259, 0, 2100, 0, 0, 0, 0, 1747, 0, 0, 0, 0, 0, 740, 0, 170, 508, 0, 0,
+				1867, 0, 477, 1610, 0, 0, 1561, 0, 0, 0, 1169, 1002, 1185, 2073, 0, 0, 0, 0, 0, 1882, 0, 0, 0, 0, 0, 1517, 1420, 1653, 0, 0, 0, 0,
+				0, 0, 1500, 159, 1634, 1091, 0, 0, 0, 1629, 445, 717, 0, 0, 1808, 1806, 0, 0, 390, 0, 1707, 1633, 1965, 86, 0, 1111, 0, 1687, 1730, 1799, 1831, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 1989, 307, 1805, 1180, 1846, 0, 2037, 313, 0, 418, 0, 0, 1464, 0, 0, 0, 1214, 1328, 0, 109, 2025, 0, 377, 562,
+				0, 1803, 0, 42, 0, 1956, 880, 1369, 1126, 0, 189, 802, 0, 55, 0, 0, 0, 0, 0, 1253, 1726, 1329, 1770, 1650, 599, 0, 1359, 798, 0, 763, 1405, 1337,
+				0, 770, 0, 879, 0, 0, 1345, 794, 0, 0, 616, 1163, 0, 0, 2089, 0, 1896, 0, 0, 0, 1283, 1200, 0, 0, 0, 0, 0, 0, 217, 1312, 1467, 818,
+				1484, 0, 1784, 1189, 990, 2069, 1683, 0, 424, 0, 0, 684, 0, 490, 0, 317, 321, 0, 1774, 0, 503, 0, 1628, 1538, 1919, 1248, 1642, 682, 1926, 0, 846, 0,
+				116, 1209, 0, 0, 1976, 750, 1052, 0, 0, 1296, 0, 0, 1828, 0, 450, 0, 0, 622, 332, 1342, 0, 1194, 0, 0, 0, 0, 0, 0, 0, 1062, 0, 442,
+				1871, 0, 0, 1225, 748, 0, 2108, 1150, 0, 213, 0, 1986, 1158, 0, 0, 0, 1360, 372, 0, 0, 1295, 1432, 0, 0, 801, 0, 0, 518, 1609, 16, 0, 0,
+				658, 0, 1510, 0, 0, 804, 0, 0, 2091, 1931, 0, 0, 1242, 1851, 0, 0, 0, 0, 0, 0, 687, 1289, 1060, 463, 0, 458, 0, 1207, 434, 1589, 105, 0,
+				0, 1013, 1277, 1870, 0, 1125, 0, 1658, 0, 315, 0, 556, 1006, 1186, 0, 1624, 1338, 1347, 0, 0, 565, 0, 0, 0, 1098, 926, 1940, 0, 615, 0, 0, 1481,
+				0, 0, 0, 0, 0, 0, 112, 0, 49, 0, 1918, 0, 0, 261, 0, 0, 1348, 0, 188, 0, 0, 0, 0, 1701, 0, 2004, 0, 0, 0, 0, 0, 0,
+				2006, 0, 0, 0, 2098, 0, 1773, 0, 0, 0, 0, 674, 1082, 1903, 466, 0, 581, 1322, 1104, 1893, 0, 1224, 1450, 0, 0, 0, 1558, 0, 0, 774, 0, 0,
+				843, 1665, 1696, 1681, 0, 1626, 567, 0, 131, 1780, 0, 428, 0, 0, 0, 642, 947, 15, 0, 0, 0, 1154, 1847, 199, 1112, 0, 0, 104, 0, 0, 25, 897,
+				0, 0, 0, 393, 1103, 0, 1950, 1178, 0, 0, 1434, 0, 1569, 0, 1761, 0, 1520, 0, 0, 0, 861, 931, 0, 0, 0, 0, 1760, 0, 0, 400, 113, 125,
+				1804, 712, 232, 0, 212, 0, 191, 0, 14, 102, 2097, 0, 0, 172, 0, 0, 0, 0, 0, 120, 0, 851, 2031, 226, 1123, 0, 285, 0, 895, 737, 32, 685,
+				0, 0, 0, 0, 939, 1436, 0, 0, 2012, 0, 0, 262, 494, 0, 1949, 0, 1379, 0, 1174, 0, 2030, 0, 0, 0, 1433, 0, 0, 632, 0, 0, 17, 0,
+				0, 0, 0, 0, 0, 0, 0, 1801, 1284, 0, 1868, 0, 203, 0, 460, 0, 0, 507, 20, 0, 1857, 1274, 168, 1305, 0, 2112, 0, 528, 0, 1330, 1833, 0,
+				0, 1832, 0, 844, 1985, 1028, 378, 605, 0, 56, 1269, 196, 1005, 0, 1424, 0, 1014, 0, 0, 0, 0, 2057, 0, 1512, 0, 965, 970, 0, 1519, 529, 1470, 1426,
+				0, 547, 1934, 0, 0, 0, 0, 0, 0, 0, 792, 715, 561, 0, 1271, 0, 821, 0, 0, 0, 0, 207, 1124, 0, 0, 1649, 0, 0, 545, 1842, 388, 0,
+				0, 0, 0, 0, 0, 311, 452, 0, 670, 0, 1752, 520, 0, 0, 0, 1930, 0, 0, 591, 0, 0, 0, 368, 0, 0, 636, 1439, 0, 1999, 474, 1877, 0,
+			};
+
+			static constexpr std::uint32_t hash_entity(std::string_view name, std::uint32_t seed) { //FNV-1a
+				std::uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+				for (char c : name) {
+					hash ^= static_cast<unsigned char>(c);
+					hash *= 16777619u;
+				}
+				return hash ^ (hash >> 15);
+			}
+			std::string_view find_named_entity(std::string_view name) {
+				std::uint32_t displacement = entity_displacements[hash_entity(name, 0) & (entity_bucket_count - 1)];
+				std::uint16_t index = entity_slots[hash_entity(name, displacement) & (entity_slot_count - 1)];
+				if (index == 0 || named_entities[index - 1].name != name) return {};
+				return named_entities[index - 1].utf8;
+			}
+
+			void append_utf8(std::uint32_t code_point, std::string& out) {
+				char buffer[4];
+				std::size_t length;
+				if (code_point < 0x80) {
+					buffer[0] = static_cast<char>(code_point);
+					length = 1;
+				} else if (code_point < 0x800) {
+					buffer[0] = static_cast<char>(0xC0 | (code_point >> 6));
+					buffer[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 2;
+				} else if (code_point < 0x10000) {
+					buffer[0] = static_cast<char>(0xE0 | (code_point >> 12));
+					buffer[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					buffer[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 3;
+				} else {
+					buffer[0] = static_cast<char>(0xF0 | (code_point >> 18));
+					buffer[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+					buffer[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					buffer[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+					length = 4;
+				}
+				out.append(buffer, length);
+			}
+			// The Char production from the XML spec
+			static bool is_xml_char(std::uint32_t code_point) {
+				return code_point == 0x9 || code_point == 0xA || code_point == 0xD
+					|| (code_point >= 0x20 && code_point <= 0xD7FF)
+					|| (code_point >= 0xE000 && code_point <= 0xFFFD)
+					|| (code_point >= 0x10000 && code_point <= 0x10FFFF);
+			}
+			static bool decode_character_reference(std::string_view digits, std::uint32_t base, std::string& out) {
+				if (digits.empty()) return false;
+				std::uint32_t code_point = 0;
+				for (char c : digits) {
+					std::uint32_t digit;
+					if (c >= '0' && c <= '9') digit = c - '0';
+					else if (base == 16 && c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+					else if (base == 16 && c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+					else return false;
+					code_point = code_point * base + digit;
+					if (code_point > 0x10FFFF) return false; //also prevents overflow
+				}
+				if (!is_xml_char(code_point)) return false;
+				append_utf8(code_point, out);
+				return true;
+			}
+			bool decode_entity(std::string_view reference, std::string& out) {
+				if (!reference.empty() && reference[0] == '#') {
+					if (reference.size() > 1 && reference[1] == 'x')
+						return decode_character_reference(reference.substr(2), 16, out);
+					return decode_character_reference(reference.substr(1), 10, out);
+				}
+				std::string_view replacement = find_named_entity(reference);
+				if (replacement.empty()) return false;
+				out.append(replacement);
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			Decoding of entity references, like &amp; &#65; or &#x42;.
+			Named references are looked up in a perfect hash table of the XML predefined entities and every
+			HTML5 named entity, so each lookup is two hashes and one verifying compare.
+			**/
+			static constexpr std::size_t max_entity_length = 32; //the longest reference between the & and the ;
+
+			// Appends the UTF-8 encoding of code_point to out. 
+			void append_utf8(std::uint32_t code_point, std::string& out);
+			// Returns the UTF-8 replacement for the named entity, or an empty view if there is no such entity.
+			std::string_view find_named_entity(std::string_view name);
+			// Appends the replacement for the reference between a & and ; to out.
+			// Returns false if it's not a known entity or a valid character reference.
+			bool decode_entity(std::string_view reference, std::string& out);
+		}
+	}
+}
@@ -0,0 +1,72 @@
+#include "xml_mapped_file.hpp"
+#include <cerrno>
+#include <limits>
+#include <string>
+#include <system_error>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+#ifdef _WIN32
+			[[noreturn]] static void throw_last_error(const char* operation, const std::filesystem::path& path) {
+				throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), operation + (": " + path.string()));
+			}
+			mapped_file::mapped_file(const std::filesystem::path& path) {
+				HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (file == INVALID_HANDLE_VALUE) throw_last_error("could not open", path);
+				file_handle_ = file;
+				LARGE_INTEGER file_size;
+				if (!GetFileSizeEx(file, &file_size)) { close(); throw_last_error("could not get size of", path); }
+				size_ = static_cast<std::uint64_t>(file_size.QuadPart);
+				if (size_ == 0) return;
+				if (size_ > std::numeric_limits<std::size_t>::max()) { close(); throw std::system_error(std::make_error_code(std::errc::file_too_large), "could not map " + path.string()); }
+				mapping_handle_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping_handle_ == nullptr) { close(); throw_last_error("could not map", path); }
+				data_ = static_cast<const char*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+				if (data_ == nullptr) { close(); throw_last_error("could not map", path); }
+			}
+			void mapped_file::close() noexcept {
+				if (data_ != nullptr) UnmapViewOfFile(data_);
+				if (mapping_handle_ != nullptr) CloseHandle(mapping_handle_);
+				if (file_handle_ != nullptr) CloseHandle(file_handle_);
+				data_ = nullptr;
+				mapping_handle_ = nullptr;
+				file_handle_ = nullptr;
+			}
+#else
+			[[noreturn]] static void throw_errno(const char* operation, const std::filesystem::path& path) {
+				throw std::system_error(errno, std::generic_category(), operation + (": " + path.string()));
+			}
+			mapped_file::mapped_file(const std::filesystem::path& path) {
+				fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				if (fd_ == -1) throw_errno("could not open", path);
+				struct stat file_stat;
+				if (::fstat(fd_, &file_stat) != 0) { close(); throw_errno("could not get size of", path); }
+				size_ = static_cast<std::uint64_t>(file_stat.st_size);
+				if (size_ == 0) return;
+				if (size_ > std::numeric_limits<std::size_t>::max()) { close(); throw std::system_error(std::make_error_code(std::errc::file_too_large), "could not map " + path.string()); }
+				void* mapping = ::mmap(nullptr, static_cast<std::size_t>(size_), PROT_READ, MAP_PRIVATE, fd_, 0);
+				if (mapping == MAP_FAILED) { close(); throw_errno("could not map", path); }
+				data_ = static_cast<const char*>(mapping);
+				::madvise(mapping, static_cast<std::size_t>(size_), MADV_SEQUENTIAL); //only a hint, so failure is harmless
+			}
+			void mapped_file::close() noexcept {
+				if (data_ != nullptr) ::munmap(const_cast<char*>(data_), static_cast<std::size_t>(size_));
+				if (fd_ != -1) ::close(fd_);
+				data_ = nullptr;
+				fd_ = -1;
+			}
+#endif
+		}
+	}
+}
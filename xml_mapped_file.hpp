@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			A read-only memory mapping of an entire file, hinted for a single sequential pass.
+			Empty files have no mapping, and simply have an empty view.
+			Throws std::system_error if the file cannot be opened or mapped.
+			**/
+			class mapped_file {
+				const char* data_ = nullptr;
+				std::uint64_t size_ = 0;
+#ifdef _WIN32
+				void* file_handle_ = nullptr;
+				void* mapping_handle_ = nullptr;
+#else
+				int fd_ = -1;
+#endif
+				void close() noexcept;
+			public:
+				mapped_file() noexcept {}
+				explicit mapped_file(const std::filesystem::path& path);
+				mapped_file(const mapped_file&) = delete;
+				mapped_file& operator=(const mapped_file&) = delete;
+				~mapped_file() { close(); }
+				std::uint64_t size() const noexcept { return size_; }
+				std::string_view view() const noexcept { return std::string_view(data_, static_cast<std::size_t>(size_)); }
+			};
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#include "xml_namespaces.hpp"
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			static constexpr std::string_view xml_namespace_uri = "http://www.w3.org/XML/1998/namespace";
+			static constexpr std::string_view xmlns_namespace_uri = "http://www.w3.org/2000/xmlns/";
+
+			void namespace_scopes::reset(symbol_table& symbols) {
+				bindings_.clear();
+				declarations_.clear();
+				qnames_.clear();
+				empty_prefix_ = symbols.intern("");
+				xmlns_ = symbols.intern("xmlns");
+				binding(symbols.intern("xml")) = symbols.intern(xml_namespace_uri);
+				binding(xmlns_) = symbols.intern(xmlns_namespace_uri);
+			}
+			void namespace_scopes::pop_while_deeper_than(std::size_t depth, bool inclusive) {
+				while (!declarations_.empty() && (declarations_.back().depth > depth || (inclusive && declarations_.back().depth == depth))) {
+					binding(declarations_.back().prefix) = declarations_.back().hidden;
+					declarations_.pop_back();
+				}
+			}
+			symbol_id& namespace_scopes::binding(symbol_id prefix) {
+				if (prefix >= bindings_.size()) bindings_.resize(prefix + 1, no_symbol);
+				return bindings_[prefix];
+			}
+
+			bool namespace_scopes::declare_if_xmlns(std::size_t depth, symbol_id attribute, std::string_view value, symbol_table& symbols, const char*& error) {
+				const qname& name = split(attribute, symbols);
+				symbol_id prefix;
+				if (name.prefix == empty_prefix_ && name.local == xmlns_) prefix = empty_prefix_; //xmlns="..." sets the default namespace
+				else if (name.prefix == xmlns_) prefix = name.local;
+				else return false;
+				if (prefix == xmlns_) {
+					error = "the xmlns prefix can't be declared";
+					return false;
+				}
+				if (value.empty() && prefix != empty_prefix_) {
+					error = "a namespace prefix can't be undeclared";
+					return false;
+				}
+				symbol_id uri = value.empty() ? no_symbol : symbols.intern(value);
+				symbol_id& bound = binding(prefix);
+				declarations_.push_back({ depth, prefix, bound });
+				bound = uri;
+				return true;
+			}
+
+			const namespace_scopes::qname& namespace_scopes::split(symbol_id name, symbol_table& symbols) {
+				if (name >= qnames_.size()) qnames_.resize(symbols.size());
+				qname& cached = qnames_[name];
+				if (cached.local == no_symbol) {
+					const std::string& full = symbols.name(name);
+					std::size_t colon = full.find(':');
+					if (colon == std::string::npos) {
+						cached.prefix = empty_prefix_;
+						cached.local = name;
+					}
+					else { //interning may grow qnames_, so cached is written through an index afterwards
+						symbol_id prefix = symbols.intern(std::string_view(full).substr(0, colon));
+						symbol_id local = symbols.intern(std::string_view(full).substr(colon + 1));
+						if (qnames_.size() < symbols.size()) qnames_.resize(symbols.size());
+						qnames_[name] = { prefix, local };
+						return qnames_[name];
+					}
+				}
+				return cached;
+			}
+			bool namespace_scopes::resolve(symbol_id name, bool attribute, symbol_table& symbols, symbol_id& uri) {
+				const qname& split_name = split(name, symbols);
+				if (split_name.prefix == empty_prefix_) {
+					uri = attribute ? (split_name.local == xmlns_ ? binding(xmlns_) : no_symbol) : binding(empty_prefix_);
+					return true;
+				}
+				uri = binding(split_name.prefix);
+				return uri != no_symbol;
+			}
+		}
+	}
+}
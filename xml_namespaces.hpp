@@ -0,0 +1,55 @@
+#pragma once
+#include "xml_symbols.hpp"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			The namespace prefixes in scope, for a reader with namespaces enabled.
+			Each prefix's current namespace is kept in an array indexed by the prefix's symbol_id, so resolving a name
+			is two array lookups, and the work of a declaration is done once, when it's declared. Each declaration saves
+			the binding it hides, and restores it when its element has closed. Elements close implicitly: a declaration
+			belongs to the element at its depth, so it's discarded once a start tag at that depth or shallower is read,
+			or a name at a shallower depth is resolved. That also handles rollback and skipped elements.
+			**/
+			class namespace_scopes {
+			public:
+				struct qname {
+					symbol_id prefix = no_symbol; //the empty prefix's id for unprefixed names
+					symbol_id local = no_symbol;
+				};
+				// Binds the reserved xml and xmlns prefixes. Called again if the symbol table changes.
+				void reset(symbol_table& symbols);
+				// Discards the declarations of elements at depth or deeper, before the start tag of an element at depth.
+				void open_element(std::size_t depth) { pop_while_deeper_than(depth, true); }
+				// Discards the declarations of elements deeper than depth.
+				void close_to(std::size_t depth) { pop_while_deeper_than(depth, false); }
+				// If attribute is xmlns or xmlns:prefix, declares it for the element at depth, and returns true.
+				// Returns false with error set if the declaration isn't allowed.
+				bool declare_if_xmlns(std::size_t depth, symbol_id attribute, std::string_view value, symbol_table& symbols, const char*& error);
+				// Splits a name into its prefix and local name, once per distinct name.
+				const qname& split(symbol_id name, symbol_table& symbols);
+				// Sets uri to the namespace of the name, or no_symbol if it has none. Unprefixed attributes have no namespace.
+				// Returns false if the prefix isn't declared.
+				bool resolve(symbol_id name, bool attribute, symbol_table& symbols, symbol_id& uri);
+			private:
+				struct declaration {
+					std::size_t depth;
+					symbol_id prefix;
+					symbol_id hidden; //the prefix's namespace before this declaration
+				};
+				void pop_while_deeper_than(std::size_t depth, bool inclusive);
+				symbol_id& binding(symbol_id prefix);
+
+				std::vector<symbol_id> bindings_; //indexed by prefix symbol_id
+				std::vector<declaration> declarations_;
+				std::vector<qname> qnames_; //indexed by name symbol_id
+				symbol_id empty_prefix_ = no_symbol;
+				symbol_id xmlns_ = no_symbol;
+			};
+		}
+	}
+}
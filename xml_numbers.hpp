@@ -0,0 +1,63 @@
+#pragma once
+#include "xml_reader.hpp"
+#include "xml_scan.hpp"
+#include <charconv>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			Locale independent number parsing straight from a view, with no NUL terminator needed.
+			A leading + is allowed, as in xsd numbers, but no whitespace, and the whole content must be the number.
+			Values that don't fit in T throw invalid_content, rather than saturating or wrapping.
+			These can be used as the stot function of mpd_xml_builder_attribute or mpd_xml_builder_text_only_parser.
+			**/
+			inline const char* skip_plus_sign(std::string_view content) {
+				const char* first = content.data();
+				if (content.size() > 1 && first[0] == '+' && first[1] != '-') ++first;
+				return first;
+			}
+			[[noreturn]] inline void throw_number_error(base_reader& reader, std::errc error, std::string_view content) {
+				if (error == std::errc::result_out_of_range) reader.throw_invalid_content("number out of range: "s + std::string(content.substr(0, 40)));
+				reader.throw_invalid_content("expected a number: "s + std::string(content.substr(0, 40)));
+			}
+			template<class T>
+			T from_chars_parser(base_reader& reader, std::string_view content) {
+				static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "from_chars_parser only parses numbers");
+				T value = {};
+				const char* last = content.data() + content.size();
+				std::from_chars_result result;
+				if constexpr (std::is_floating_point_v<T>)
+					result = std::from_chars(skip_plus_sign(content), last, value, std::chars_format::general);
+				else
+					result = std::from_chars(skip_plus_sign(content), last, value, 10);
+				if (result.ec != std::errc() || result.ptr != last) throw_number_error(reader, result.ec != std::errc() ? result.ec : std::errc::invalid_argument, content);
+				return value;
+			}
+			/**
+			Parses a list of whitespace separated numbers, such as an SVG or COLLADA coordinate list, calling add(value) for each.
+			Separators are found with a vectorized scan and each number is converted in place, so no string is built for
+			the list or for any of the numbers in it.
+			**/
+			template<class T, class add_t>
+			void parse_number_list(base_reader& reader, std::string_view content, add_t&& add) {
+				const char* data = content.data();
+				std::size_t size = content.size();
+				std::size_t idx = 0;
+				while (true) {
+					std::size_t separator_end = idx + skip_space_or_control(data + idx, size - idx);
+					for (; idx < separator_end; ++idx) {
+						if (!is_whitespace(data[idx])) reader.throw_invalid_content("unexpected control character in a list of numbers");
+					}
+					if (idx == size) return;
+					std::size_t length = find_space_or_control(data + idx, size - idx);
+					add(from_chars_parser<T>(reader, std::string_view(data + idx, length)));
+					idx += length;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "xml_reader.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			Splits the root element's content into chunks at guessed record boundaries, and reads the chunks on several threads.
+			A guess is only trusted if the reader of the previous chunk ended exactly there. Otherwise that chunk's results
+			are discarded and it's read again, on the calling thread, from where the previous chunk really ended.
+			Results and errors are taken in document order, so the first error thrown is the one a sequential read would throw.
+			**/
+			struct parallel_records {
+				template<class child_parser_t>
+				using element_type = typename std::remove_reference_t<child_parser_t>::element_type;
+				template<class child_parser_t>
+				struct chunk {
+					std::vector<element_type<child_parser_t>> records;
+					std::uint64_t end = 0;
+					bool closed_root = false;
+					std::exception_ptr error;
+				};
+				// Each worker has its own reader over the same input, and its own copy of the parser, and of the symbol_table and DTD.
+				template<class child_parser_t>
+				struct worker {
+					reader reader_;
+					child_parser_t parser_;
+					symbol_id root_id = no_symbol;
+					symbol_id record_id = no_symbol;
+					worker(const reader& document, const char* root_tag, const char* record_tag, const child_parser_t& parser)
+						: reader_(std::string(document.source_name_), document.window)
+						, parser_(parser)
+					{
+						reader_.inherit_prolog(document);
+						root_id = reader_.symbols_->intern(root_tag);
+						record_id = reader_.symbols_->intern(record_tag);
+					}
+					void read(chunk<child_parser_t>& result, std::uint64_t begin, std::uint64_t stop) {
+						result = chunk<child_parser_t>{};
+						try {
+							reader_.seek_root_content(begin, root_id);
+							result.closed_root = reader_.read_records(parser_, record_id, stop, [&result](element_type<child_parser_t>&& record) {
+								result.records.push_back(std::move(record));
+							});
+							result.end = reader_.buffer_idx;
+						}
+						catch (...) {
+							result.error = std::current_exception();
+						}
+					}
+				};
+
+				template<class child_parser_t>
+				static std::vector<element_type<child_parser_t>> read(document_reader& document, const char* root_tag, const char* record_tag, const child_parser_t& parser, std::size_t thread_count) {
+					reader& main = document.reader_;
+					std::vector<element_type<child_parser_t>> records;
+					if (!main.open_root(root_tag)) {
+						main.finish_root(main.buffer_idx);
+						return records;
+					}
+					const std::uint64_t content_begin = main.buffer_idx;
+					const std::uint64_t input_size = main.window.size();
+					if (thread_count == 0) thread_count = 1;
+
+					std::vector<std::uint64_t> starts{ content_begin };
+					const std::string pattern = "<"s + record_tag;
+					const std::size_t chunk_count = thread_count == 1 ? 1 : thread_count * 4; //more chunks than threads, so that uneven chunks even out
+					for (std::size_t i = 1; i < chunk_count; ++i) {
+						std::uint64_t nominal = content_begin + (input_size - content_begin) * i / chunk_count;
+						std::uint64_t start = main.find_record_start(pattern, std::max(nominal, starts.back() + 1));
+						if (start >= input_size) break;
+						starts.push_back(start);
+					}
+					auto stop_of = [&starts, input_size](std::size_t i) { return i + 1 < starts.size() ? starts[i + 1] : input_size; };
+
+					std::vector<chunk<child_parser_t>> chunks(starts.size());
+					std::atomic<std::size_t> next_chunk{ 0 };
+					// A thread that can't make its worker leaves the error in the chunk it took, and the other threads read the rest.
+					// If none can, chunk 0 holds an error, so the chunks that no thread took are never looked at.
+					auto work = [&]() {
+						std::size_t i = next_chunk++;
+						if (i >= chunks.size()) return;
+						std::optional<worker<child_parser_t>> chunk_reader;
+						try {
+							chunk_reader.emplace(main, root_tag, record_tag, parser);
+						}
+						catch (...) {
+							chunks[i].error = std::current_exception();
+							return;
+						}
+						do chunk_reader->read(chunks[i], starts[i], stop_of(i));
+						while ((i = next_chunk++) < chunks.size());
+					};
+					{
+						std::vector<std::thread> threads;
+						struct join_guard { //joins the threads started so far even if starting the next one throws, since they use chunks
+							std::vector<std::thread>& threads;
+							~join_guard() { for (std::thread& thread : threads) thread.join(); }
+						} joiner{ threads };
+						threads.reserve(std::min(thread_count, chunks.size()));
+						for (std::size_t i = 1; i < std::min(thread_count, chunks.size()); ++i)
+							threads.emplace_back(work);
+						work();
+					}
+
+					std::size_t total = 0;
+					for (const chunk<child_parser_t>& chunk : chunks)
+						total += chunk.records.size();
+					records.reserve(total);
+					std::unique_ptr<worker<child_parser_t>> fallback;
+					std::uint64_t position = content_begin;
+					for (std::size_t i = 0; i < chunks.size(); ++i) {
+						if (starts[i] != position) { //the guessed boundary was wrong, so read this chunk again from the real one
+							if (!fallback) fallback = std::make_unique<worker<child_parser_t>>(main, root_tag, record_tag, parser);
+							fallback->read(chunks[i], position, stop_of(i));
+						}
+						if (chunks[i].error) std::rethrow_exception(chunks[i].error);
+						std::move(chunks[i].records.begin(), chunks[i].records.end(), std::back_inserter(records));
+						position = chunks[i].end;
+						if (chunks[i].closed_root) break;
+					}
+					main.finish_root(position);
+					return records;
+				}
+			};
+		}
+
+		/**
+		Reads a document made of one root element holding many sibling records, such as <catalog><record/>...</catalog>,
+		on thread_count threads, and returns the records in document order. Whitespace, comments and processing
+		instructions between records are skipped, and any other child of the root throws unexpected_node.
+		This needs a document_reader over a contiguous or memory mapped source, since each thread reads its own part of it.
+		Only UTF-8 (or ASCII) content is parsed in place, though. A contiguous source in UTF-16, ISO-8859-1 or windows-1252 is
+		transcoded as it's read, like a stream, so it throws invalid_read_call_error here. Convert such a document to UTF-8 first.
+		Each thread has its own copy of the parser, and its own copy of the symbol_table, so symbol ids of names first seen in
+		the records are only meaningful within one record. Entities and attribute defaults declared in a DOCTYPE apply to every
+		record, and each thread has its own entity expansion budget. With namespaces enabled, the root's declarations are in scope in every record.
+		**/
+		template<class child_parser_t>
+		std::vector<typename std::remove_reference_t<child_parser_t>::element_type> read_records_parallel(document_reader& document, const char* root_tag, const char* record_tag,
+			const child_parser_t& parser, std::size_t thread_count = std::thread::hardware_concurrency())
+		{ return impl::parallel_records::read(document, root_tag, record_tag, parser, thread_count); }
+	}
+}
@@ -1,5 +1,15 @@
 #pragma once
+#include "xml_numbers.hpp"
 #include "xml_reader.hpp"
+#include "xml_writer.hpp"
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
 
 namespace mpd {
 	namespace xml {
@@ -12,72 +22,246 @@ namespace mpd {
 		*/
 		namespace builder {
 			namespace impl {
-				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<std::is_member_function_pointer_v<funcT>,bool> =true>
+				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<!std::is_member_pointer_v<funcT>,bool> =true>
 				auto invoke_add_item(base_reader& reader, Container& container, Item&& item) -> decltype(func(reader, container, std::move(item))) {return func(reader, container, std::move(item));}
-				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<std::is_member_function_pointer_v<funcT>,bool> =true>
-				auto invoke_add_item(base_reader& reader, Container& container, Item&& item) -> decltype(func(container, std::move(item))) {return func(container, std::move(item));}
+				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<!std::is_member_pointer_v<funcT>,bool> =true>
+				auto invoke_add_item(base_reader&, Container& container, Item&& item) -> decltype(func(container, std::move(item))) {return func(container, std::move(item));}
 				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<std::is_member_function_pointer_v<funcT>,bool> =true>
 				auto invoke_add_item(base_reader&, Container& container, Item&& item) -> decltype((container.*func)(std::move(item))) {return (container.*func)(std::move(item));}
-				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<!std::is_member_function_pointer_v<funcT>,bool> =true>
+				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<std::is_member_object_pointer_v<funcT>,bool> =true>
 				auto invoke_add_item(base_reader&, Container& container, Item&& item) -> decltype((container.*func)=std::move(item)) {return (container.*func)=std::move(item);}
+				// A member that is a container of the items, such as &two::nodes for a std::vector<three>, is appended to.
+				template<class funcT, funcT func, class Container, class Item, std::enable_if_t<std::is_member_object_pointer_v<funcT> && !std::is_assignable_v<decltype((std::declval<Container&>().*func)), Item&&>,bool> =true>
+				auto invoke_add_item(base_reader&, Container& container, Item&& item) -> decltype((container.*func).emplace_back(std::move(item))) {return (container.*func).emplace_back(std::move(item));}
+				template<class T> constexpr bool dependent_false = false;
+				template<class T, class = void> struct has_empty : std::false_type {};
+				template<class T> struct has_empty<T, std::void_t<decltype(std::declval<const T&>().empty())>> : std::true_type {};
+				// Allocator aware types, like std::pmr::vector or a struct with an allocator_type, are built with the reader's memory resource.
+				template<class T>
+				T make_item(base_reader& reader) {
+					using allocator_t = std::pmr::polymorphic_allocator<std::byte>;
+					if constexpr (std::uses_allocator_v<T, allocator_t> && std::is_constructible_v<T, allocator_t>) return T(allocator_t(reader.memory_resource()));
+					else return T();
+				}
 				template<class funcT, funcT func>
 				auto invoke_stot(base_reader& reader, std::string&& content) -> decltype(func(reader, std::move(content))) {return func(reader, std::move(content));}
 				template<class funcT, funcT func>
 				auto invoke_stot(base_reader&, std::string&& content) -> decltype(func(std::move(content))) {return func(std::move(content));}
+				// Passes the view straight through if func takes a std::string_view, and only builds a std::string if it doesn't.
+				// Returns by value, since func may return a reference into that temporary string.
+				template<class funcT, funcT func>
+				auto invoke_stot(base_reader& reader, std::string_view content) {
+					if constexpr (std::is_invocable_v<funcT, base_reader&, std::string_view>) return func(reader, content);
+					else if constexpr (std::is_invocable_v<funcT, std::string_view>) return func(content);
+					else return invoke_stot<funcT, func>(reader, std::string(content));
+				}
+
+				/*
+				Maps the names of a parser's children to their index in O(1), with one verifying compare.
+				Like the named entity table in xml_entities.cpp, it's a hash and displace table: each name is hashed to one of 
+				about count/2 buckets, and each bucket has its own seed, searched for so that the bucket's names hash to empty 
+				slots of a table at least twice the size of the name count. So a lookup is always two hashes, one probe, and 
+				one memcmp, however the names collide. The table is built by a constexpr function, so when the names are 
+				constexpr (like `inline constexpr char name[] = "name";`), it's built at compile time. Otherwise it's built 
+				once, on first use. A name repeated in the list finds its first parser.
+				*/
+				constexpr std::size_t name_length(const char* name) {
+					std::size_t length = 0;
+					while (name[length] != '\0') ++length;
+					return length;
+				}
+				constexpr std::uint64_t hash_name(const char* name, std::size_t length, std::uint64_t seed) { //FNV-1a
+					std::uint64_t hash = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+					for (std::size_t i = 0; i < length; ++i) {
+						hash ^= static_cast<unsigned char>(name[i]);
+						hash *= 1099511628211ull;
+					}
+					return hash ^ (hash >> 29);
+				}
+				constexpr std::size_t name_table_slots(std::size_t count) {
+					std::size_t slots = 2;
+					while (slots < count * 2) slots *= 2;
+					return slots;
+				}
+				constexpr std::size_t name_table_buckets(std::size_t count) {
+					std::size_t buckets = 1;
+					while (buckets * 2 < count) buckets *= 2;
+					return buckets;
+				}
+				template<std::size_t count>
+				struct name_table {
+					static constexpr std::size_t slot_count = name_table_slots(count);
+					static constexpr std::size_t bucket_count = name_table_buckets(count);
+					std::array<const char*, count> names = {};
+					std::array<std::size_t, count> lengths = {};
+					std::array<std::size_t, slot_count> slots = {}; //index+1, or 0 if empty
+					std::array<std::uint32_t, bucket_count> displacements = {}; //the seed for each bucket's names
+
+					// returns the index of the name, or count if it's not in the table
+					std::size_t find(const std::string& name) const {
+						std::uint32_t displacement = displacements[hash_name(name.data(), name.size(), 0) & (bucket_count - 1)];
+						std::size_t index = slots[hash_name(name.data(), name.size(), displacement) & (slot_count - 1)];
+						if (index == 0) return count;
+						--index;
+						if (lengths[index] == name.size() && std::memcmp(names[index], name.data(), name.size()) == 0) return index;
+						return count;
+					}
+				};
+				constexpr bool same_name(const char* a, std::size_t a_length, const char* b, std::size_t b_length) {
+					if (a_length != b_length) return false;
+					for (std::size_t i = 0; i < a_length; ++i)
+						if (a[i] != b[i]) return false;
+					return true;
+				}
+				template<std::size_t count>
+				constexpr name_table<count> make_name_table(const std::array<const char*, count>& names) {
+					name_table<count> table;
+					std::array<std::size_t, count> bucket_of = {};
+					std::array<bool, count> repeated = {}; //names already in the list, which are left out
+					std::array<std::size_t, name_table<count>::bucket_count> bucket_sizes = {};
+					std::size_t largest = 0;
+					for (std::size_t i = 0; i < count; ++i) {
+						table.names[i] = names[i];
+						table.lengths[i] = name_length(names[i]);
+						for (std::size_t j = 0; j < i && !repeated[i]; ++j)
+							repeated[i] = same_name(table.names[i], table.lengths[i], table.names[j], table.lengths[j]);
+						if (repeated[i]) continue;
+						bucket_of[i] = hash_name(table.names[i], table.lengths[i], 0) & (table.bucket_count - 1);
+						largest = std::max(largest, ++bucket_sizes[bucket_of[i]]);
+					}
+					// The fullest buckets are placed first, while the table is emptiest.
+					for (std::size_t size = largest; size > 0; --size) {
+						for (std::size_t bucket = 0; bucket < table.bucket_count; ++bucket) {
+							if (bucket_sizes[bucket] != size) continue;
+							std::array<std::size_t, count> placed = {};
+							for (std::uint32_t displacement = 1; ; ++displacement) {
+								std::size_t placed_count = 0;
+								bool fits = true;
+								for (std::size_t i = 0; i < count && fits; ++i) {
+									if (repeated[i] || bucket_of[i] != bucket) continue;
+									std::size_t slot = hash_name(table.names[i], table.lengths[i], displacement) & (table.slot_count - 1);
+									fits = table.slots[slot] == 0;
+									for (std::size_t j = 0; j < placed_count && fits; ++j)
+										fits = placed[j] != slot;
+									placed[placed_count++] = slot;
+								}
+								if (!fits) continue;
+								table.displacements[bucket] = displacement;
+								placed_count = 0;
+								for (std::size_t i = 0; i < count; ++i)
+									if (!repeated[i] && bucket_of[i] == bucket) table.slots[placed[placed_count++]] = i + 1;
+								break;
+							}
+						}
+					}
+					return table;
+				}
 			}
 
 			template<const char* name_, class stot_t, stot_t stot, class set_attr_t, set_attr_t set_attr, bool required=true>
 			struct attribute {
 				bool found = false;
 				void reset() {found = false;}
-				const char* name() const {return name_;}
+				static constexpr const char* name() {return name_;}
 				template<class Container>
-				bool parse_attribute(Container& container, attribute_reader& reader, std::string&& content)
+				bool parse_attribute(Container& container, attribute_reader& reader, std::string_view content)
 				{ 
 					if (found) reader.throw_unexpected("duplicate attribute "s + name_);
-					auto&& attr = impl::invoke_stot<stot_t, stot>(reader, std::move(content));
+					found = true;
+					auto&& attr = impl::invoke_stot<stot_t, stot>(reader, content);
 					impl::invoke_add_item<set_attr_t, set_attr>(reader, container, std::move(attr));
 					return true;
 				}
 				void end(base_reader& reader) {
-					if(required && !found) return reader.throw_missing("missing "s + name_);
+					if(required && !found) reader.throw_missing(node_type::attribute_node, name_);
+				}
+				// Writing reads the value back through set_attr, so it must be a member pointer.
+				template<class Container>
+				void write(document_writer& writer, const Container& container) const {
+					static_assert(std::is_member_object_pointer_v<set_attr_t>, "writing an attribute needs set_attr to be a member pointer");
+					writer.attribute(name_, container.*set_attr);
 				}
 			};
 #define mpd_xml_builder_attribute(name, stot, set_attr) mpd::xml::builder::attribute<name, decltype(stot), stot, decltype(set_attr), set_attr>
 			template<const char* name_, class child_parser_t, class add_child_t, add_child_t add_child, int min=0, int max=1>
 			struct element {
 				int found = 0;
+				child_parser_t child_parser; //one instance for every child with this name, so any capacity it keeps is reused
 				void reset() {found = 0;}
-				const char* name() const {return name_;}
+				static constexpr const char* name() {return name_;}
 				template<class Container>
 				bool parse_child_element(Container& container, element_reader& reader) {
 					if (++found > max) reader.throw_unexpected("too many "s + name_);
-					auto&& child = reader.read_child(child_parser_t{});
+					auto&& child = reader.read_child(child_parser);
 					impl::invoke_add_item<add_child_t, add_child>(reader, container, std::move(child));
 					return true;
 				}
 				void end(base_reader& reader) {
-					if(found < min) return reader.throw_missing("too few "s + tag_);
+					if(found < min) reader.throw_missing(node_type::element_node, name_, "too few");
+				}
+				// Writing reads the children back through add_child. A member pointer names the child, or a container or optional
+				// of children. A member function, like &std::vector<T>::emplace_back, means the container itself holds the children.
+				template<class Container>
+				void write(document_writer& writer, const Container& container) const {
+					if constexpr (std::is_member_object_pointer_v<add_child_t>) write_children(writer, container.*add_child);
+					else if constexpr (std::is_member_function_pointer_v<add_child_t>) write_children(writer, container);
+					else static_assert(impl::dependent_false<Container>, "writing an element needs add_child to be a member pointer");
+				}
+			private:
+				template<class children_t>
+				void write_children(document_writer& writer, const children_t& children) const {
+					using child_t = typename std::remove_reference_t<child_parser_t>::element_type;
+					if constexpr (std::is_same_v<children_t, child_t>) {
+						if constexpr (min == 0 && impl::has_empty<child_t>::value) { //an optional child that is a container is only written if it has contents
+							if (children.empty()) return;
+						}
+						child_parser.write_element(writer, name_, children);
+					}
+					else if constexpr (xml::impl::is_optional_v<children_t>) {
+						if (children.has_value()) child_parser.write_element(writer, name_, *children);
+					}
+					else for (const child_t& child : children) child_parser.write_element(writer, name_, child);
 				}
 			};
 #define mpd_xml_builder_element_optional(name, child_parser_t, add_child) mpd::xml::builder::element<name, child_parser_t, decltype(add_child), add_child, 0, 1>
 #define mpd_xml_builder_element_required(name, child_parser_t, add_child) mpd::xml::builder::element<name, child_parser_t, decltype(add_child), add_child, 1, 1>
-#define mpd_xml_builder_element_repeating(name, child_parser_t, add_child) mpd::xml::builder::element<name, child_parser_t, decltype(add_child), add_child, 0, 0xFFFFFFFF>
+#define mpd_xml_builder_element_repeating(name, child_parser_t, add_child) mpd::xml::builder::element<name, child_parser_t, decltype(add_child), add_child, 0, INT_MAX>
 			template<class s_to_t_t, s_to_t_t s_to_t, class add_text_t, add_text_t add_text>
 			struct text {
 				template<class Container>
-				void parse_child_text(Container& container, base_reader& reader, std::string&& content) {
-					auto&& item = impl::invoke_stot<s_to_t_t, s_to_t>(reader, std::move(content));
+				void parse_child_text(Container& container, base_reader& reader, std::string_view content) {
+					auto&& item = impl::invoke_stot<s_to_t_t, s_to_t>(reader, content);
 					impl::invoke_add_item<add_text_t, add_text>(reader, container, std::move(item));
 				}
+				template<class Container>
+				void write(document_writer& writer, const Container& container) const {
+					static_assert(std::is_member_object_pointer_v<add_text_t>, "writing text needs add_text to be a member pointer");
+					writer.text(container.*add_text);
+				}
 			};
 #define mpd_xml_builder_text(s_to_t, add_text) mpd::xml::builder::text<decltype(s_to_t), s_to_t, decltype(add_text), add_text>
+			// Appends each whitespace separated number in the text to a container member, such as a std::vector<double>.
+			template<class numbers_t, numbers_t numbers>
+			struct numeric_array_text {
+				template<class Container>
+				void parse_child_text(Container& container, base_reader& reader, std::string_view content) {
+					auto& values = container.*numbers;
+					using value_type = typename std::remove_reference_t<decltype(values)>::value_type;
+					xml::impl::parse_number_list<value_type>(reader, content, [&values](value_type value) { values.push_back(value); });
+				}
+				template<class Container>
+				void write(document_writer& writer, const Container& container) const
+				{ writer.number_list(container.*numbers); }
+			};
+#define mpd_xml_builder_numeric_array_text(numbers) mpd::xml::builder::numeric_array_text<decltype(numbers), numbers>
 
 			struct no_text_parser {
 				template<class Container>
-				void parse_child_text(Container&, base_reader& reader, std::string&&) {
+				void parse_child_text(Container&, base_reader& reader, std::string_view) {
 					reader.throw_unexpected();
 				}
+				template<class Container>
+				void write(document_writer&, const Container&) const {}
 			};
 
 			template<class T, class element_parser_tuple, class attribute_parser_tuple=std::tuple<>, class text_parser_t=no_text_parser>
@@ -88,67 +272,109 @@ namespace mpd {
 				std::tuple<element_parsers_t...> element_parsers;
 				std::tuple<attribute_parsers_t...> attribute_parsers;
 				text_parser_t text_parser;
+
+				// Children are found by name in a hash table, and then dispatched by index through a table of member pointers.
+				using element_handler = bool (parser::*)(element_reader&, T&);
+				using attribute_handler = bool (parser::*)(attribute_reader&, std::string_view, T&);
+				template<std::size_t I>
+				bool parse_child_element_at(element_reader& reader, T& item) 
+				{ return std::get<I>(element_parsers).parse_child_element(item, reader); }
+				template<std::size_t I>
+				bool parse_attribute_at(attribute_reader& reader, std::string_view value, T& item) 
+				{ return std::get<I>(attribute_parsers).parse_attribute(item, reader, value); }
+				template<std::size_t... Is>
+				static constexpr std::array<element_handler, sizeof...(Is)> make_element_handlers(std::index_sequence<Is...>)
+				{ return { &parser::parse_child_element_at<Is>... }; }
+				template<std::size_t... Is>
+				static constexpr std::array<attribute_handler, sizeof...(Is)> make_attribute_handlers(std::index_sequence<Is...>)
+				{ return { &parser::parse_attribute_at<Is>... }; }
+				static const impl::name_table<sizeof...(element_parsers_t)>& element_names() {
+					static const impl::name_table<sizeof...(element_parsers_t)> table = impl::make_name_table<sizeof...(element_parsers_t)>({ element_parsers_t::name()... });
+					return table;
+				}
+				static const impl::name_table<sizeof...(attribute_parsers_t)>& attribute_names() {
+					static const impl::name_table<sizeof...(attribute_parsers_t)> table = impl::make_name_table<sizeof...(attribute_parsers_t)>({ attribute_parsers_t::name()... });
+					return table;
+				}
 			public:
 				using element_type = T;
 				void reset() { 
-					(std::get<element_parsers_t>(element_parsers).reset(),...); 
-					(std::get<attribute_parsers_t>(attribute_parsers).reset(),...); 
+					std::apply([](auto&... parsers) { (parsers.reset(), ...); }, element_parsers);
+					std::apply([](auto&... parsers) { (parsers.reset(), ...); }, attribute_parsers);
 				}
 				T parse_tag(tag_reader& reader, const std::string&) { 
-					T item;
+					T item = impl::make_item<T>(reader);
 					return reader.read_element(*this, item); 
 				}
-				void parse_attribute(attribute_reader& reader, const std::string& name, std::string&& value, T& item) {
-					bool parsed = (
-						(std::get<attribute_parsers_t>(attribute_parsers).name() == name 
-							&& std::get<attribute_parsers_t>(attribute_parsers).parse_attribute(item, reader, std::move(value)))
-						|| ...);
-					if (!parsed) reader.throw_unexpected("unexpected attribute " + name);
+				void parse_attribute(attribute_reader& reader, const std::string& name, std::string_view value, T& item) {
+					static constexpr std::array<attribute_handler, sizeof...(attribute_parsers_t)> handlers = make_attribute_handlers(std::index_sequence_for<attribute_parsers_t...>{});
+					std::size_t index = attribute_names().find(name);
+					if (index == sizeof...(attribute_parsers_t)) reader.throw_unexpected("unexpected attribute " + name);
+					(this->*handlers[index])(reader, value, item);
+				}
+				parser& parse_content(base_reader& reader, T&) { 
+					std::apply([&reader](auto&... parsers) { (parsers.end(reader), ...); }, attribute_parsers);
+					return *this; 
 				}
-				parser parse_content(base_reader&, T&) { return *this; }
 				void parse_child_element(element_reader& reader, const std::string& child_tag, T& item) {
-					bool parsed = (
-						(std::get<element_parsers_t>(element_parsers).name() == name 
-							&& std::get<element_parsers_t>(element_parsers).parse_child_element(item, reader))
-						|| ...);
-					if (!parsed) reader.throw_unexpected("unexpected tag " + child_tag);
+					static constexpr std::array<element_handler, sizeof...(element_parsers_t)> handlers = make_element_handlers(std::index_sequence_for<element_parsers_t...>{});
+					std::size_t index = element_names().find(child_tag);
+					if (index == sizeof...(element_parsers_t)) reader.throw_unexpected("unexpected tag " + child_tag);
+					(this->*handlers[index])(reader, item);
 				}
-				void parse_child_node(base_reader& reader, node_type type, std::string&& content, T& item) {
+				void parse_child_node(base_reader& reader, node_type type, std::string_view content, T& item) {
 					if (type != node_type::string_node)
 						reader.throw_unexpected("unexpected node type ");
 					else {
 						std::string_view view = mpd::trim(content);
 						if (!view.empty())
-							text_parser.parse_child_text(item, reader, std::string(view));
+							text_parser.parse_child_text(item, reader, view);
 					}
 				}
 				T&& end_parse(base_reader& reader, T& item) {
-					(std::get<element_parsers_t>(element_parsers).end(reader), ...);
+					std::apply([&reader](auto&... parsers) { (parsers.end(reader), ...); }, element_parsers);
 					return std::move(item);
 				}
+				void write_element(document_writer& writer, const char* tag, const T& item) const {
+					writer.start_element(tag);
+					std::apply([&writer, &item](const auto&... parsers) { (parsers.write(writer, item), ...); }, attribute_parsers);
+					text_parser.write(writer, item);
+					std::apply([&writer, &item](const auto&... parsers) { (parsers.write(writer, item), ...); }, element_parsers);
+					writer.end_element();
+				}
 			};
 			template<class T, class s_to_t_t, s_to_t_t s_to_t>
 			struct text_only_parser {
 			private:
-				T item;
-				bool found;
+				std::optional<T> item; //emplaced rather than assigned, so that allocator aware types keep their allocator
 			public:
 				using element_type = T;
-				void reset() { item = {}; found = false;}
-				void parse_child_node(base_reader& reader, node_type type, std::string&& content) {
-					if (type != node_type::string_node || found)
+				void reset() { item.reset(); }
+				T parse_tag(tag_reader& reader, const std::string&)
+				{ return reader.read_element(*this); }
+				void parse_attribute(attribute_reader& reader, const std::string& name, std::string_view)
+				{ reader.throw_unexpected("unexpected attribute " + name); }
+				text_only_parser& parse_content(base_reader&)
+				{ return *this; }
+				void parse_child_element(element_reader& reader, const std::string&)
+				{ reader.throw_unexpected(); }
+				void parse_child_node(base_reader& reader, node_type type, std::string_view content) {
+					if (type != node_type::string_node || item.has_value())
 						reader.throw_unexpected();
 					else {
 						std::string_view view = mpd::trim(content);
-						if (!view.empty()) {
-							item = invoke_stot<s_to_t_t, s_to_t>(reader, std::move(content));
-							found = true;
-						}
+						if (!view.empty())
+							item.emplace(impl::invoke_stot<s_to_t_t, s_to_t>(reader, view));
 					}
 				}
 				T&& end_parse(base_reader& reader) {
-					if (!found) reader.throw_missing();
-					return std::move(item);
+					if (!item.has_value()) reader.throw_missing(node_type::string_node, "text");
+					return std::move(item).value();
+				}
+				void write_element(document_writer& writer, const char* tag, const T& value) const {
+					writer.start_element(tag);
+					writer.text(value);
+					writer.end_element();
 				}
 			};
 #define mpd_xml_builder_text_only_parser(T, s_to_t) mpd::xml::builder::text_only_parser<T, decltype(s_to_t), s_to_t>
@@ -0,0 +1,119 @@
+#include "xml_push_reader.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			void push_input::feed(std::string_view chunk) {
+				if (finished_) throw invalid_read_call_error("push_reader was fed after finish");
+				pending_.append(chunk);
+				scan();
+			}
+			void push_input::finish() {
+				finished_ = true;
+				released_ = pending_.size();
+			}
+			std::size_t push_input::read(char* buffer, std::size_t count) {
+				std::size_t read_cnt = std::min(count, released_ - read_);
+				std::memcpy(buffer, pending_.data() + read_, read_cnt);
+				read_ += read_cnt;
+				if (read_ > pending_.size() / 2) { //compacting less often than every read keeps large feeds linear
+					pending_.erase(0, read_);
+					released_ -= read_;
+					scanned_ -= read_;
+					markup_begin_ -= std::min(markup_begin_, read_);
+					read_ = 0;
+				}
+				return read_cnt;
+			}
+			void push_input::release_markup() {
+				released_ = scanned_;
+				state_ = scan_state::text;
+			}
+			// Returns false if the terminator isn't in the input yet, leaving scanned_ where a partial terminator could start.
+			bool push_input::scan_until(std::string_view terminator) {
+				std::size_t idx = std::string_view(pending_).find(terminator, scanned_);
+				if (idx == std::string_view::npos) {
+					if (pending_.size() >= terminator.size()) scanned_ = std::max(scanned_, pending_.size() - terminator.size() + 1);
+					return false;
+				}
+				scanned_ = idx + terminator.size();
+				release_markup();
+				return true;
+			}
+			void push_input::scan() {
+				std::string_view input = pending_;
+				while (scanned_ < input.size()) {
+					switch (state_) {
+					case scan_state::text: {
+						std::size_t idx = input.find('<', scanned_);
+						if (idx == std::string_view::npos) {
+							scanned_ = input.size();
+							return;
+						}
+						markup_begin_ = idx;
+						scanned_ = idx + 1;
+						state_ = scan_state::markup_start;
+						break;
+					}
+					case scan_state::markup_start: {
+						std::string_view markup = input.substr(markup_begin_);
+						auto could_become = [markup](std::string_view start) { return markup.size() < start.size() && start.substr(0, markup.size()) == markup; };
+						if (could_become("<!--") || could_become("<![CDATA[")) return; //wait to see which it is
+						if (markup.substr(0, 4) == "<!--") { state_ = scan_state::comment; scanned_ = markup_begin_ + 4; }
+						else if (markup.substr(0, 9) == "<![CDATA[") { state_ = scan_state::cdata; scanned_ = markup_begin_ + 9; }
+						else if (markup.substr(0, 2) == "<?") { state_ = scan_state::processing_instruction; scanned_ = markup_begin_ + 2; }
+						else if (markup.substr(0, 2) == "<!") { state_ = scan_state::declaration; scanned_ = markup_begin_ + 2; bracket_depth_ = 0; }
+						else state_ = scan_state::tag;
+						break;
+					}
+					case scan_state::tag:
+					case scan_state::declaration: {
+						std::size_t idx = input.find_first_of(state_ == scan_state::tag ? "\"'>" : "\"'[]>", scanned_);
+						if (idx == std::string_view::npos) {
+							scanned_ = input.size();
+							return;
+						}
+						scanned_ = idx + 1;
+						char c = input[idx];
+						if (c == '[') ++bracket_depth_;
+						else if (c == ']') { if (bracket_depth_ > 0) --bracket_depth_; }
+						else if (c == '>') { if (bracket_depth_ == 0) release_markup(); }
+						else {
+							quoted_from_ = state_;
+							quote_ = c;
+							state_ = scan_state::quoted;
+						}
+						break;
+					}
+					case scan_state::quoted: {
+						std::size_t idx = input.find(quote_, scanned_);
+						if (idx == std::string_view::npos) {
+							scanned_ = input.size();
+							return;
+						}
+						scanned_ = idx + 1;
+						state_ = quoted_from_;
+						break;
+					}
+					case scan_state::comment: if (!scan_until("-->")) return; break;
+					case scan_state::cdata: if (!scan_until("]]>")) return; break;
+					case scan_state::processing_instruction: if (!scan_until("?>")) return; break;
+					}
+				}
+			}
+		}
+
+		push_reader::push_reader(std::string source_name, std::size_t buffer_size)
+			: push_reader_members(std::move(source_name), buffer_size)
+			, cursor(tokenizer_)
+		{}
+		void push_reader::feed(std::string_view chunk) {
+			input_.feed(chunk);
+		}
+		void push_reader::finish() {
+			input_.finish();
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "xml_cursor.hpp"
+#include <string>
+#include <string_view>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			The bytes fed to a push_reader, and how many of them the reader may read.
+			A resumable scanner follows the markup across feeds, and only releases bytes up to the end of the last
+			complete tag, comment, CDATA section, processing instruction or declaration. So the reader never runs out
+			of input in the middle of a token, and only ever has to wait at a node boundary.
+			**/
+			class push_input {
+				enum class scan_state { text, markup_start, tag, quoted, comment, cdata, processing_instruction, declaration };
+				std::string pending_; //fed bytes, of which those from read_ on haven't been read yet
+				std::size_t read_ = 0;
+				std::size_t released_ = 0; //bytes at the front of pending_ that may be read, including those already read
+				std::size_t scanned_ = 0; //bytes at the front of pending_ that the scanner has seen
+				std::size_t markup_begin_ = 0; //where the markup being scanned starts
+				scan_state state_ = scan_state::text;
+				scan_state quoted_from_ = scan_state::tag; //the state to return to after a quoted value
+				char quote_ = 0;
+				std::size_t bracket_depth_ = 0; //for the internal subset of a DOCTYPE
+				bool finished_ = false;
+				void scan();
+				bool scan_until(std::string_view terminator);
+				void release_markup();
+			public:
+				void feed(std::string_view chunk);
+				void finish();
+				std::size_t read(char* buffer, std::size_t count);
+				bool more_input() const { return !finished_; }
+			};
+			class push_read_buf final : public read_buf_t {
+				push_input* input_;
+			public:
+				explicit push_read_buf(push_input& input) : input_(&input) {}
+				virtual push_read_buf* copy_construct_at(char* buffer, std::size_t buffer_size)const&
+				{ assert(buffer_size > sizeof(push_read_buf)); return new(buffer)push_read_buf(*this); }
+				virtual push_read_buf* move_construct_at(char* buffer, std::size_t buffer_size) &
+				{ assert(buffer_size > sizeof(push_read_buf)); return new(buffer)push_read_buf(std::move(*this)); }
+				virtual std::size_t read(char* buffer, std::size_t count) { return input_->read(buffer, count); }
+				virtual bool more_input() const { return input_->more_input(); }
+			};
+			// Holds the input and reader, so that they're constructed before the cursor base of push_reader.
+			struct push_reader_members {
+				push_input input_;
+				reader tokenizer_;
+				push_reader_members(std::string&& source_name, std::size_t buffer_size)
+					: tokenizer_(std::move(source_name), buffer_size, std::in_place_type_t<push_read_buf>{}, input_)
+				{}
+			};
+		}
+
+		/**
+		A cursor that is fed input as it arrives, rather than pulling it from a source, such as for XML received
+		over a network connection in pieces. Feed each piece, then call next() until it returns need_input, and
+		return to the event loop until the next piece arrives. After the last piece, call finish().
+
+			reader.feed(chunk);
+			for (cursor_event event; (event = reader.next()) != cursor_event::need_input && event != cursor_event::end_document; )
+				handle(reader);
+
+		Text around a CDATA section may arrive as several text events, if it was fed in pieces. skip_element and read_child
+		need the whole element to have been fed, since they can't wait for input.
+		**/
+		class push_reader : private impl::push_reader_members, public cursor {
+		public:
+			explicit push_reader(std::string source_name, std::size_t buffer_size = impl::default_buffer_size);
+			// Copies the chunk, so it need not outlive the call.
+			void feed(std::string_view chunk);
+			// Marks the end of the input. Anything left incomplete is then reported as unexpected eof by next().
+			void finish();
+		};
+	}
+}
@@ -0,0 +1,268 @@
+#include "xml_query.hpp"
+#include "xml_scan.hpp"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			static bool parse_number(std::string_view text, double& number) {
+				text = mpd::trim(text);
+				if (!text.empty() && text.front() == '+') text.remove_prefix(1);
+				std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), number);
+				return result.ec == std::errc() && result.ptr == text.data() + text.size() && !text.empty();
+			}
+			bool query_predicate::matches(std::string_view value) const {
+				if (op == comparison::exists) return true;
+				if (!numeric) {
+					switch (op) {
+					case comparison::equal: return value == literal;
+					case comparison::not_equal: return value != literal;
+					case comparison::less: return value < literal;
+					case comparison::less_equal: return value <= literal;
+					case comparison::greater: return value > literal;
+					default: return value >= literal;
+					}
+				}
+				double attribute_number;
+				if (!parse_number(value, attribute_number)) return op == comparison::not_equal; //as NaN compares in XPath
+				switch (op) {
+				case comparison::equal: return attribute_number == number;
+				case comparison::not_equal: return attribute_number != number;
+				case comparison::less: return attribute_number < number;
+				case comparison::less_equal: return attribute_number <= number;
+				case comparison::greater: return attribute_number > number;
+				default: return attribute_number >= number;
+				}
+			}
+
+			// A recursive descent over one path.
+			class path_parser {
+				std::string_view path_;
+				std::size_t idx_ = 0;
+			public:
+				explicit path_parser(std::string_view path) : path_(path) {}
+				[[noreturn]] void fail(const char* details) const {
+					throw std::invalid_argument("invalid path query \"" + std::string(path_) + "\" at " + std::to_string(idx_) + ": " + details);
+				}
+				bool at_end() const { return idx_ == path_.size(); }
+				char peek() const { return at_end() ? '\0' : path_[idx_]; }
+				bool accept(std::string_view token) {
+					if (path_.substr(idx_, token.size()) != token) return false;
+					idx_ += token.size();
+					return true;
+				}
+				void skip_ws() { while (!at_end() && is_whitespace(path_[idx_])) ++idx_; }
+				std::string name() {
+					std::size_t begin = idx_;
+					if (at_end() || !is_name_start_char(path_[idx_])) fail("expected a name");
+					while (!at_end() && is_name_char(path_[idx_])) ++idx_;
+					return std::string(path_.substr(begin, idx_ - begin));
+				}
+				query_predicate predicate() {
+					query_predicate predicate;
+					skip_ws();
+					if (!accept("@")) fail("predicates must test an attribute, like [@id] or [@id='x']");
+					predicate.attribute = name();
+					skip_ws();
+					using comparison = query_predicate::comparison;
+					if (accept("!=")) predicate.op = comparison::not_equal;
+					else if (accept("<=")) predicate.op = comparison::less_equal;
+					else if (accept(">=")) predicate.op = comparison::greater_equal;
+					else if (accept("=")) predicate.op = comparison::equal;
+					else if (accept("<")) predicate.op = comparison::less;
+					else if (accept(">")) predicate.op = comparison::greater;
+					if (predicate.op != comparison::exists) {
+						skip_ws();
+						char quote = peek();
+						if (quote == '\'' || quote == '"') {
+							std::size_t end = path_.find(quote, idx_ + 1);
+							if (end == std::string_view::npos) fail("unterminated string");
+							predicate.literal = std::string(path_.substr(idx_ + 1, end - idx_ - 1));
+							idx_ = end + 1;
+						}
+						else {
+							std::size_t begin = idx_;
+							while (!at_end() && path_[idx_] != ']' && !is_whitespace(path_[idx_])) ++idx_;
+							predicate.literal = std::string(path_.substr(begin, idx_ - begin));
+							if (!parse_number(predicate.literal, predicate.number)) fail("expected a quoted string or a number");
+							predicate.numeric = true;
+						}
+						skip_ws();
+					}
+					if (!accept("]")) fail("expected ]");
+					return predicate;
+				}
+				compiled_query query() {
+					compiled_query query;
+					if (peek() != '/') fail("paths must be absolute, and start with / or //");
+					while (!at_end()) {
+						bool descendant = accept("//");
+						if (!descendant && !accept("/")) fail("expected / or //");
+						if (accept("@")) {
+							if (descendant) fail("an attribute must be a child step, like /@id");
+							query.result = compiled_query::result_kind::attribute;
+							query.result_attribute = name();
+							break;
+						}
+						if (accept("text()")) {
+							if (descendant) fail("text() must be a child step, like /text()");
+							query.result = compiled_query::result_kind::text;
+							break;
+						}
+						query_step step;
+						step.descendant = descendant;
+						if (!accept("*")) step.name = name();
+						while (accept("["))
+							step.predicates.push_back(predicate());
+						query.steps.push_back(std::move(step));
+					}
+					if (!at_end()) fail("@attr and text() must be the last step");
+					if (query.steps.empty()) fail("expected an element step");
+					return query;
+				}
+			};
+		}
+
+		path_query::path_query(std::initializer_list<std::string_view> paths) {
+			for (std::string_view path : paths) compile(path);
+		}
+		path_query::path_query(const std::vector<std::string>& paths) {
+			for (const std::string& path : paths) compile(path);
+		}
+		void path_query::compile(std::string_view path) {
+			queries_.push_back(impl::path_parser(path).query());
+		}
+
+		std::string_view path_query::find_attribute(symbol_id name) const {
+			for (const attribute_value& attribute : attributes_)
+				if (attribute.name == name) return std::string_view(attribute_text_).substr(attribute.offset, attribute.length);
+			return std::string_view(nullptr, 0);
+		}
+		bool path_query::predicates_match(const impl::query_step& step) const {
+			for (const impl::query_predicate& predicate : step.predicates) {
+				std::string_view value = find_attribute(predicate.attribute_id);
+				if (value.data() == nullptr || !predicate.matches(value)) return false;
+			}
+			return true;
+		}
+
+		/*
+		The automaton is a set of states per open element: the queries that could still match below it, and how many
+		of their steps have matched. A child element advances every state whose next step it matches, and descendant
+		steps also stay in the set, to match deeper. An element whose set is empty can't contain a match, so it's skipped.
+		*/
+		std::size_t path_query::run(cursor& cursor, symbol_table& symbols, impl::query_callback on_match, void* context) {
+			for (impl::compiled_query& query : queries_) {
+				for (impl::query_step& step : query.steps) {
+					step.name_id = step.name.empty() ? no_symbol : symbols.intern(step.name);
+					for (impl::query_predicate& predicate : step.predicates)
+						predicate.attribute_id = symbols.intern(predicate.attribute);
+				}
+				if (query.result == impl::compiled_query::result_kind::attribute) query.result_id = symbols.intern(query.result_attribute);
+			}
+			states_.clear();
+			frame_ends_.clear();
+			collector_count_ = 0;
+			for (std::uint32_t query = 0; query < queries_.size(); ++query)
+				states_.push_back({ query, 0 });
+			frame_ends_.push_back(states_.size());
+
+			std::size_t match_count = 0;
+			for (cursor_event event; (event = cursor.next()) != cursor_event::end_document; ) {
+				switch (event) {
+				case cursor_event::start_element: {
+					const symbol_id name = cursor.name_id();
+					const std::size_t parent_begin = frame_ends_.size() > 1 ? frame_ends_[frame_ends_.size() - 2] : 0;
+					const std::size_t parent_end = frame_ends_.back();
+					candidates_.clear();
+					bool need_attributes = false;
+					for (std::size_t i = parent_begin; i < parent_end; ++i) {
+						state current = states_[i];
+						const impl::compiled_query& query = queries_[current.query];
+						const impl::query_step& step = query.steps[current.step];
+						if (step.descendant && std::find(states_.begin() + parent_end, states_.end(), current) == states_.end())
+							states_.push_back(current);
+						if (step.name_id == no_symbol || step.name_id == name) {
+							candidates_.push_back(current);
+							if (!step.predicates.empty() || (current.step + 1 == query.steps.size() && query.result == impl::compiled_query::result_kind::attribute))
+								need_attributes = true;
+						}
+					}
+					attributes_.clear();
+					attribute_text_.clear();
+					if (need_attributes) {
+						while (cursor.next_attribute()) {
+							std::string_view value = cursor.value();
+							attributes_.push_back({ cursor.name_id(), attribute_text_.size(), value.size() });
+							attribute_text_.append(value.data(), value.size());
+						}
+					}
+					matched_.clear();
+					for (state candidate : candidates_) {
+						const impl::compiled_query& query = queries_[candidate.query];
+						if (!predicates_match(query.steps[candidate.step])) continue;
+						state advanced{ candidate.query, candidate.step + 1 };
+						if (advanced.step < query.steps.size()) {
+							if (std::find(states_.begin() + parent_end, states_.end(), advanced) == states_.end())
+								states_.push_back(advanced);
+							continue;
+						}
+						if (std::find(matched_.begin(), matched_.end(), candidate.query) != matched_.end()) continue;
+						matched_.push_back(candidate.query);
+						if (query.result == impl::compiled_query::result_kind::attribute) {
+							std::string_view value = find_attribute(query.result_id);
+							if (value.data() != nullptr) {
+								++match_count;
+								on_match(context, candidate.query, value);
+							}
+						}
+						else {
+							if (collector_count_ == collectors_.size()) collectors_.emplace_back();
+							collector& added = collectors_[collector_count_++];
+							added.query = candidate.query;
+							added.level = frame_ends_.size();
+							added.direct_only = query.result == impl::compiled_query::result_kind::text;
+							added.text.clear();
+							added.has_text = false;
+						}
+					}
+					// The element is needed if a query may match inside it, it's collecting its own text, or an ancestor is collecting all of its text.
+					bool needed = states_.size() != parent_end;
+					for (std::size_t i = collector_count_; i > 0 && !needed; --i)
+						needed = !collectors_[i - 1].direct_only || collectors_[i - 1].level == frame_ends_.size();
+					if (!needed) cursor.skip_element();
+					else frame_ends_.push_back(states_.size());
+					break;
+				}
+				case cursor_event::end_element: {
+					std::size_t level = frame_ends_.size() - 1;
+					while (collector_count_ > 0 && collectors_[collector_count_ - 1].level == level) {
+						collector& done = collectors_[--collector_count_];
+						if (done.direct_only && !done.has_text) continue; //text() of an element without text is no match
+						++match_count;
+						on_match(context, done.query, done.text);
+					}
+					states_.resize(frame_ends_[level - 1]);
+					frame_ends_.pop_back();
+					break;
+				}
+				case cursor_event::text: {
+					std::string_view text = cursor.value();
+					const std::size_t level = frame_ends_.size() - 1;
+					for (std::size_t i = 0; i < collector_count_; ++i)
+						if (!collectors_[i].direct_only || collectors_[i].level == level) {
+							collectors_[i].text.append(text.data(), text.size());
+							collectors_[i].has_text = true;
+						}
+					break;
+				}
+				default:
+					break;
+				}
+			}
+			return match_count;
+		}
+	}
+}
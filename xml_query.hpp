@@ -0,0 +1,108 @@
+#pragma once
+#include "xml_cursor.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			struct query_predicate {
+				enum class comparison { exists, equal, not_equal, less, less_equal, greater, greater_equal };
+				std::string attribute;
+				symbol_id attribute_id = no_symbol;
+				comparison op = comparison::exists;
+				std::string literal;
+				bool numeric = false; //the literal is a number, so the attribute is compared as a number
+				double number = 0;
+				bool matches(std::string_view value) const;
+			};
+			struct query_step {
+				bool descendant = false; //preceded by //, so it may match at any depth below the previous step
+				std::string name; //empty for *
+				symbol_id name_id = no_symbol;
+				std::vector<query_predicate> predicates;
+			};
+			struct compiled_query {
+				enum class result_kind { element, attribute, text };
+				std::vector<query_step> steps;
+				result_kind result = result_kind::element;
+				std::string result_attribute;
+				symbol_id result_id = no_symbol;
+			};
+			using query_callback = void(*)(void* context, std::size_t query, std::string_view value);
+		}
+
+		/**
+		Several path queries, compiled into one automaton that runs over a document's events in a single pass, such as
+		to pull a few values out of each record without a parser for every level, or building the document.
+
+			mpd::xml::path_query query({ "/one/two/@attr1", "//three[@attr1>5]/@attr2" });
+			query.run(document, [](std::size_t query, std::string_view value) { ... });
+
+		Paths are a subset of XPath: absolute paths of / (child) and // (descendant) steps, each an element name or *,
+		with any number of [@attr] or [@attr op literal] predicates, where op is one of = != < <= > >=, and the literal
+		is a quoted string or a number (which compares the attribute as a number). Unlike in XPath, < <= > >= against a
+		quoted string compare the attribute with it byte by byte, so [@version>'10'] matches version="9".
+		The last step may be @attr, for the attribute's value, or text(), for the element's own text. Otherwise the result
+		is all the text inside the element.
+		Results are reported in document order, as each one completes, and each element matches a query at most once.
+		Subtrees that no query can match are skipped without tokenizing them.
+		**/
+		class path_query {
+		public:
+			// Throws std::invalid_argument if a path isn't in the supported subset.
+			explicit path_query(std::initializer_list<std::string_view> paths);
+			explicit path_query(const std::vector<std::string>& paths);
+			std::size_t size() const { return queries_.size(); }
+
+			// Reads the rest of the document, and calls on_match(query index, value) for every match.
+			// The value is only valid during the call. Returns the number of matches.
+			template<class callback_t>
+			std::size_t run(document_reader& document, callback_t&& on_match) {
+				cursor cursor(document);
+				return run(cursor, *document.symbols(), [](void* context, std::size_t query, std::string_view value) {
+					(*static_cast<std::remove_reference_t<callback_t>*>(context))(query, value);
+				}, &on_match);
+			}
+		private:
+			// A query that has matched its first step steps, and is looking for the next one.
+			struct state {
+				std::uint32_t query;
+				std::uint32_t step;
+				bool operator==(const state& other) const { return query == other.query && step == other.step; }
+			};
+			// An element that matched a query whose result is its text, collecting until it closes.
+			struct collector {
+				std::uint32_t query;
+				std::size_t level;
+				bool direct_only;
+				bool has_text;
+				std::string text;
+			};
+			struct attribute_value {
+				symbol_id name;
+				std::size_t offset;
+				std::size_t length;
+			};
+			void compile(std::string_view path);
+			std::size_t run(cursor& cursor, symbol_table& symbols, impl::query_callback on_match, void* context);
+			std::string_view find_attribute(symbol_id name) const;
+			bool predicates_match(const impl::query_step& step) const;
+
+			std::vector<impl::compiled_query> queries_;
+			// Reused across elements and runs, so that steady state matching doesn't allocate.
+			std::vector<state> states_; //the states of every open element, one frame after another
+			std::vector<std::size_t> frame_ends_;
+			std::vector<state> candidates_;
+			std::vector<std::uint32_t> matched_;
+			std::vector<collector> collectors_;
+			std::size_t collector_count_ = 0;
+			std::vector<attribute_value> attributes_;
+			std::string attribute_text_;
+		};
+	}
+}
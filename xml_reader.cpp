@@ -1,124 +1,27 @@
 #include "xml_reader.hpp"
 #include <algorithm>
+#include <cerrno>
 #include <limits>
+#include <system_error>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace mpd {
 	namespace xml {
 		namespace impl {
-#ifdef _DEBUG
-			static const std::size_t BUFFER_SIZE = 15;
-#else 
-			static const std::size_t BUFFER_SIZE = 1042;
-#endif
-
-			const int html_escape_code_hash_size = 7;
-			std::pair<int, int> html_escape_codes[html_escape_code_hash_size] = {
-				{0,0},
-				{2249262,8364},//euro
-				{65935,'&'},//amp
-				{0,0},
-				{2419,'<'},//lt
-				{2259,'>'},//gt
-				{2642387,'"'},//quot
-			};
-			int deescape(const char* escape, std::size_t& char_count) { //points at character after &
-				char_count = 0;
-				if (escape[0] == '#') {
-					++escape;
-					int base = 10;
-					if (escape[1] == 'x') {
-						++escape;
-						base = 16;
-					}
-					int value = 0;
-					while (*escape != ';') {
-						if (*escape >= '0' && *escape <= '9')
-							value = value * base + (*escape - '0');
-						else if (*escape >= 'a' && *escape <= 'f')
-							value = value * 16 + (*escape - 'a' + 10);
-						else if (*escape >= 'A' && *escape <= 'F')
-							value = value * 16 + (*escape - 'A' + 10);
-						else
-							return -1;
-						++char_count;
-						++escape;
-					}
-					return value;
-				} else {
-					int hash = (*escape >= 'A' && *escape <= 'Z') ? 1 : 2;
-					while (*escape != ';') {
-						hash *= 32;
-						if (*escape >= 'a' && *escape <= 'z')
-							hash += *escape - 'a';
-						else if (*escape >= 'A' && *escape <= 'Z')
-							hash += *escape - 'A';
-						else if (*escape >= '0' && *escape <= '8')
-							hash += *escape - '0' + 26;
-						else
-							return -1;
-						++char_count;
-						++escape;
-					}
-					int pos = hash % html_escape_code_hash_size;
-					if (html_escape_codes[pos].first == hash)
-						return html_escape_codes[pos].second;
-					else
-						return -1;
-				}
-			}
-			bool validate_escape_codes() {
-#ifdef _DEBUG
-				std::size_t cnt;
-				assert(deescape("quot;", cnt) == '"');
-				assert(deescape("amp;", cnt) == '&');
-				assert(deescape("lt;", cnt) == '<');
-				assert(deescape("gt;", cnt) == '>');
-				assert(deescape("euro;", cnt) == 8364);
-#endif
-				return true;
-			}
-			static const bool html_escape_codes_validation = validate_escape_codes();
-
-			void append_utf8(int cp, std::string& str) {
-				char buffer[5] = {};
-				if (cp <= 0x7F) {
-					buffer[0] = (char)cp;
-				} else if (cp < 0x7FF) {
-					buffer[0] = 0xC0 | (char)(cp >> 6);
-					buffer[1] = 0x80 | (char)(cp & 0x3F);
-
-				} else if (cp < 0x7FFF) {
-					buffer[0] = 0xC0 | (char)(cp >> 12);
-					buffer[1] = 0x80 | (char)((cp >> 6) & 0x3F);
-					buffer[2] = 0x80 | (char)(cp & 0x3F);
-				} else {
-					buffer[0] = 0xC0 | (char)(cp >> 18);
-					buffer[1] = 0x80 | (char)((cp >> 12) & 0x3F);
-					buffer[2] = 0x80 | (char)((cp >> 6) & 0x3F);
-					buffer[3] = 0x80 | (char)(cp & 0x3F);
-				}
-				str.append(buffer);
-			}
-
-			bool in_range(char c, char min, char max) 
-			{ return c>=min && c<=max; }
-			bool is_whitespace(char c) 
-			{ return c == ' ' || c == '\n' || c == '\t' || c=='\r'; }
-			bool is_name_start_char(char c) 
-			{ return c == ':' || in_range(c, 'A', 'Z') || c == '_' || in_range(c, 'a', 'z') || c<0 || c>127; }
-			bool is_name_char(char c) 
-			{ return is_name_start_char(c) || c=='-' || c=='.' || in_range(c,'0','9'); }
-
-
 			std::string reader::get_parse_state_name() {
 				switch (position.state) {
 				case parse_state::document_begin: return "document start";
-				case parse_state::after_tag_name: return position.tag_name + " open tag";
-				case parse_state::after_attribute: return attribute_set[attribute_count-1] + " attribute with value " + node.second.substr(0, 25);
-				case parse_state::before_tag_finish: return position.tag_name + " content begin";
-				case parse_state::after_open_tag: return position.tag_name + " details";
+				case parse_state::after_tag_name: return symbols_->name(tag_ids[position.tag_depth]) + " open tag";
+				case parse_state::after_attribute: return symbols_->name(attribute_id) + " attribute with value " + std::string(node_value.substr(0, 25));
+				case parse_state::before_tag_finish: return symbols_->name(tag_ids[position.tag_depth]) + " content begin";
+				case parse_state::after_open_tag: return symbols_->name(tag_ids[position.tag_depth - 1]) + " details";
 				case parse_state::document_end: return "document end";
-				case parse_state::after_node: return get_node_type_string(node.first, position.tag_name);
+				case parse_state::after_node: return get_node_type_string(node.first, tag_ids[position.tag_depth] != no_symbol ? symbols_->name(tag_ids[position.tag_depth]) : std::string());
+				case parse_state::unrecoverable: return "unrecoverable rollback";
 				default:
 					assert(false);
 					return "UNKNOWN STATE[" + std::to_string((int)position.state) +"]";
@@ -138,8 +41,30 @@ namespace mpd {
 				}
 			}
 
+			// A '\n' starts a new line at column 0, '\r' does not advance the column, and every other byte advances the column.
+			static void advance_location(reader::location& loc, const char* span, std::size_t count) {
+				std::size_t line_start = count;
+				while (line_start > 0 && span[line_start - 1] != '\n')
+					--line_start;
+				if (line_start > 0) {
+					loc.line += count_char(span, line_start, '\n');
+					loc.column = 0;
+				}
+				loc.column += (count - line_start) - count_char(span + line_start, count - line_start, '\r');
+				loc.offset += count;
+			}
+			reader::location reader::get_location() {
+				std::uint64_t offset = window_offset + buffer_idx;
+				if (checkpoint.offset > offset) //rolled back to before the checkpoint
+					checkpoint = window_location;
+				assert(checkpoint.offset >= window_offset);
+				std::size_t checkpoint_idx = static_cast<std::size_t>(checkpoint.offset - window_offset);
+				advance_location(checkpoint, window.data() + checkpoint_idx, buffer_idx - checkpoint_idx);
+				return checkpoint;
+			}
 			std::string reader::get_location_for_exception() {
-				return source_name_ + '(' + std::to_string(position.line) + ',' + std::to_string(position.column) + ")";
+				location loc = get_location();
+				return source_name_ + '(' + std::to_string(loc.line) + ',' + std::to_string(loc.column) + ")";
 			}
 
 			void reader::throw_unexpected(const char* details) {
@@ -176,287 +101,807 @@ namespace mpd {
 				skip_ws();
 				char peekc = peek();
 				if (peekc == '/' || peekc == '>') {
+					if (dtd_.has_attribute_defaults() && next_default_attribute()) return true;
 					position.state = parse_state::before_tag_finish;
 					return false;
 				}
-				if (attribute_set.size() == attribute_count) attribute_set.resize(attribute_count + 1);
-				read_name(attribute_set[attribute_count]);
-				auto dup_iter = std::find(attribute_set.begin(), attribute_set.begin() + attribute_count, attribute_set[attribute_count]);
-				if (dup_iter != attribute_set.begin() + attribute_count) throw_duplicate_attribute("duplicate attribute " + attribute_set[attribute_count]);
-				++attribute_count;
+				attribute_id = read_symbol();
+				if (attribute_id >= attribute_stamps.size()) attribute_stamps.resize(symbols_->size());
+				if (attribute_stamps[attribute_id] == attribute_generation) throw_duplicate_attribute("duplicate attribute " + symbols_->name(attribute_id));
+				attribute_stamps[attribute_id] = attribute_generation;
 				skip_ws();
 				affirm_next_char('=', 0, "missing = after attribute_name");
 				skip_ws();
 				char quote = affirm_next_char('\"', '\'', "attribute value must be wrapped in quotes");
 				read_attr(quote);
 				position.state = parse_state::after_attribute;
+				if (namespaces_enabled_ && !declarations_prescanned_) declare_namespace(attribute_id, node_value);
 				return true;
 			}
 			bool reader::next_node() {
-				if (at_eof()) return false;
-				if (position.state == parse_state::before_tag_finish) {
-					char c = peek();
-					if (c == '/') {
-						consume_nonws();
-						affirm_next_char('>', 0, "> must immediately follow /");
-						position.state = parse_state::after_node;
-						return false;
-					} else {
-						affirm_next_char('>', 0, "> must close a tag");
-						position.state = parse_state::after_open_tag;
+				require_recoverable();
+				while (true) {
+					switch (read_node()) {
+					case read_result::node: return true;
+					case read_result::close_tag: return false;
+					default: if (at_eof()) return false;
 					}
 				}
+			}
+			reader::read_result reader::read_node() {
+				if (at_eof()) return read_result::close_tag;
+				if (position.state == parse_state::before_tag_finish && !finish_tag()) return read_result::close_tag;
 				assert(position.state == parse_state::document_begin 
 					|| position.state == parse_state::after_node
 					|| position.state == parse_state::after_open_tag);
 				char c = peek();
-				if (c != '<' || peek("<!CDATA[")) {
+				if (c != '<' || peek("<![CDATA[")) {
 					read_string();
 					position.state = parse_state::after_node;
 				} else {
-					consume_maybe_ws();
+					consume();
 					c = peek();
-					if (is_name_start_char(c)) return read_tag_name();
-					else if (c == '/') return read_close_tag();
+					if (is_name_start_char(c)) {
+						read_tag_name();
+						return read_result::node;
+					}
+					else if (c == '/') {
+						read_close_tag();
+						return read_result::close_tag;
+					}
 					else if (c == '?') read_processing_instruction(); //   <?xml version="1.0"?>
 					else if (peek("!--")) read_comment();
-					else if (peek("!ATTLIST ")) parse_attribute_list();
-					else if (peek("!DOCTYPE ")) read_doctype();
-					else if (peek("!ELEMENT ")) read_element_type();
-					else if (peek("!NOTATION ")) read_notation();
-					else if (peek("!% ")) read_conditional();
+					else if (peek("!DOCTYPE")) {
+						read_doctype();
+						position.state = parse_state::after_node;
+						return read_result::nothing;
+					}
 					else throw_malformed_xml("invalid tag start: "s + c);
+					node_value = node.second;
 					position.state = parse_state::after_node;
 				}
-				return true;
+				return read_result::node;
 			};
+			// Reads the > or /> at the end of an open tag. Returns false for an empty element tag, which has no content.
+			bool reader::finish_tag() {
+				assert(position.state == parse_state::before_tag_finish);
+				if (peek() == '/') {
+					consume();
+					affirm_next_char('>', 0, "> must immediately follow /");
+					position.state = parse_state::after_node;
+					return false;
+				}
+				affirm_next_char('>', 0, "> must close a tag");
+				position.state = parse_state::after_open_tag;
+				if (tag_ids.size() == ++position.tag_depth) tag_ids.resize(position.tag_depth + 1, no_symbol);
+				return true;
+			}
 			char reader::affirm_next_char(char c1, char c2, const char* message) {
 				char c = peek();
 				if (c != c1 && c != c2) throw_malformed_xml(message);
-				return consume_nonws();
+				return consume();
 			}
 			void reader::skip_ws() {
 				do {
-					while(buffer_idx<buffer.size()) {
-						if (!is_whitespace(buffer[buffer_idx]))
-							return;
-						consume_maybe_ws();
-					}
+					std::size_t end = buffer_idx;
+					while (end < window.size() && is_whitespace(window[end])) 
+						++end;
+					consume(end - buffer_idx);
+					if (buffer_idx < window.size())
+						return;
 				} while (!at_eof());
 			};
-			void reader::read_name(std::string& out) {
-				out.clear();
+			// Names are interned straight from the window, unless they're split across a refill.
+			symbol_id reader::read_symbol() {
+				name_scratch.clear();
 				char first = peek();
 				if (!is_name_start_char(first)) throw_malformed_xml(first + " is not a valid char for starting a name"s);
-				out.append(1, consume_nonws());
 				do {
-					while(buffer_idx<buffer.size()) {
-						if (!is_name_char(buffer[buffer_idx]))
-							return;
-						out.append(1, consume_nonws());
+					std::size_t end = buffer_idx;
+					while (end < window.size() && is_name_char(window[end]))
+						++end;
+					std::string_view span = window.substr(buffer_idx, end - buffer_idx);
+					consume(span.size());
+					if (buffer_idx < window.size()) {
+						if (name_scratch.empty()) return symbols_->intern(span);
+						name_scratch.append(span);
+						return symbols_->intern(name_scratch);
 					}
+					name_scratch.append(span);
 				} while (!at_eof());
-				throw_unexpeced_eof("while parsing name " + out.substr(0, 20));
+				throw_unexpeced_eof("while parsing name "s + std::string(std::string_view(name_scratch).substr(0, 20)));
 			};
+			void reader::begin_attributes() {
+				if (++attribute_generation == 0) { //wrapped, so old stamps could match again
+					std::fill(attribute_stamps.begin(), attribute_stamps.end(), 0);
+					attribute_generation = 1;
+				}
+				attribute_id = no_symbol;
+				next_default_attribute_ = 0;
+			}
+			symbol_id reader::name_id() const {
+				switch (position.state) {
+				case parse_state::after_tag_name: 
+				case parse_state::before_tag_finish: return tag_ids[position.tag_depth];
+				case parse_state::after_attribute: return attribute_id;
+				default: return no_symbol;
+				}
+			}
+			// pmr containers keep their allocator when assigned to, so they're rebuilt in place to change it.
+			template<class container_t>
+			static void rebuild_with_resource(container_t& container, std::pmr::memory_resource* resource) {
+				container_t replacement(container.begin(), container.end(), resource);
+				container.~container_t();
+				new(&container) container_t(std::move(replacement));
+			}
+			void reader::use_memory_resource(std::pmr::memory_resource* resource) {
+				if (position.state != parse_state::document_begin) throw_invalid_read_call("the memory resource can only be changed before reading");
+				resource_ = resource;
+				rebuild_with_resource(tag_ids, resource);
+				rebuild_with_resource(buffer, resource);
+				rebuild_with_resource(attribute_stamps, resource);
+				rebuild_with_resource(name_scratch, resource);
+			}
+			void reader::share_symbols(std::shared_ptr<symbol_table> symbols) {
+				if (position.state != parse_state::document_begin) throw_invalid_read_call("symbols can only be shared before reading");
+				symbols_ = std::move(symbols);
+				attribute_stamps.clear();
+				if (namespaces_enabled_) namespaces_.reset(*symbols_);
+			}
+			void reader::enable_namespaces() {
+				if (position.state != parse_state::document_begin) throw_invalid_read_call("namespaces can only be enabled before reading");
+				if (namespaces_enabled_) return;
+				namespaces_enabled_ = true;
+				namespaces_.reset(*symbols_);
+			}
+			symbol_id reader::namespace_id() {
+				if (!namespaces_enabled_) throw_invalid_read_call("namespaces aren't enabled. Call document_reader#enable_namespaces before reading");
+				return resolve_namespace(name_id(), position.state == parse_state::after_attribute);
+			}
+			symbol_id reader::resolve_namespace(symbol_id name, bool attribute) {
+				if (name == no_symbol) return no_symbol;
+				namespaces_.close_to(position.tag_depth); //the current element is at tag_depth, both in and after its tags
+				symbol_id uri;
+				if (!namespaces_.resolve(name, attribute, *symbols_, uri)) throw_malformed_xml("undeclared namespace prefix in " + symbols_->name(name));
+				return uri;
+			}
+			symbol_id reader::local_name_id() {
+				symbol_id name = name_id();
+				return name == no_symbol ? no_symbol : namespaces_.split(name, *symbols_).local;
+			}
+			// Content is only copied into node.second once an escape or a refill forces it.
+			// Until then, the bytes from the source offset span_begin up to buffer_idx are the content so far, still in the window.
+			void reader::flush_node_value(std::uint64_t& span_begin) {
+				std::size_t begin_idx = static_cast<std::size_t>(span_begin - window_offset);
+				node.second.append(window.data() + begin_idx, buffer_idx - begin_idx);
+				span_begin = window_offset + buffer_idx;
+			}
+			void reader::finish_node_value(std::uint64_t span_begin) {
+				if (node.second.empty()) {
+					std::size_t begin_idx = static_cast<std::size_t>(span_begin - window_offset);
+					node_value = window.substr(begin_idx, buffer_idx - begin_idx);
+				} else {
+					flush_node_value(span_begin);
+					node_value = node.second;
+				}
+			}
+			std::string& reader::owned_node_value() {
+				if (node_value.data() != node.second.data()) node.second.assign(node_value);
+				return node.second;
+			}
 			void reader::read_attr(char quote) {
 				node.second.clear();
+				std::uint64_t span_begin = window_offset + buffer_idx;
 				do {
-					while(buffer_idx<buffer.size()) {
-						char c = buffer[buffer_idx];
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, quote, '&', '<');
+					consume(span);
+					if (span < remaining) {
+						char c = window[buffer_idx];
 						if (c == quote) {
-							consume_nonws();
+							finish_node_value(span_begin);
+							consume();
 							return;
 						} else if (c == '&') {
+							flush_node_value(span_begin);
 							consume_escape(node.second);
-						} else if (c == '<') {
+							span_begin = window_offset + buffer_idx;
+						} else
 							throw_invalid_content("attribute cannot contain <");
-						} else 
-							node.second.append(1, consume_maybe_ws());
-					}
-				} while (!at_eof());
-				throw_unexpeced_eof("while parsing attribute " + attribute_set[attribute_count-1]);
+					} else
+						flush_node_value(span_begin); //about to refill
+				} while (buffer_idx < window.size() || !at_eof());
+				throw_unexpeced_eof("while parsing attribute " + symbols_->name(attribute_id));
 			};
 			void reader::read_string() {
-				assert(buffer[buffer_idx] != '<' || peek("<[CADATA["));
+				assert(window[buffer_idx] != '<' || peek("<![CDATA["));
 				node.first = node_type::string_node;
 				node.second.clear();
+				std::uint64_t span_begin = window_offset + buffer_idx;
 				do {
-					while(buffer_idx<buffer.size()) {
-						if (buffer[buffer_idx] == '&') {
-							consume_nonws();
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, '<', '&');
+					consume(span);
+					if (span < remaining) {
+						if (window[buffer_idx] == '&') {
+							flush_node_value(span_begin);
 							consume_escape(node.second);
-						} else if (buffer[buffer_idx] == '<') {
-							if (peek("<![CDATA[")) append_cdata();
-							else return;
+							span_begin = window_offset + buffer_idx;
+							continue;
+						}
+						if (buffer_idx + 9 > window.size()) flush_node_value(span_begin); //peek may refill
+						if (peek("<![CDATA[")) {
+							flush_node_value(span_begin);
+							append_cdata();
+							span_begin = window_offset + buffer_idx;
 						} else 
-							node.second.append(1, consume_maybe_ws());
-					}
-				} while (!at_eof());
-				return;
+							break;
+					} else
+						flush_node_value(span_begin); //about to refill
+				} while (buffer_idx < window.size() || !at_eof());
+				finish_node_value(span_begin);
 			}
 			bool reader::read_tag_name() {
 				node.first = node_type::element_node;
-				read_name(node.second);
+				tag_ids[position.tag_depth] = read_symbol();
 				position.state = parse_state::after_tag_name;
-				position.tag_name = node.second;
+				if (namespaces_enabled_) prescan_namespace_declarations();
 				return true;
 			}
+			/*
+			An element's namespace can be declared by its own attributes, but parsers dispatch on it in parse_child_element,
+			before they're read. So the rest of the start tag is scanned for xmlns attributes as soon as its name is read,
+			without consuming it. Tags split across a refill are scanned after a refill, and the buffer grows to fit a tag
+			longer than it. If the input ends first (or a push_reader hasn't been fed the rest yet), the declarations
+			are made as the attributes are read instead, so the element's own namespace is only known after those.
+			xmlns attributes the DTD defaults for the element, and the tag leaves out, are declared by the scan too.
+			*/
+			void reader::prescan_namespace_declarations() {
+				namespaces_.open_element(position.tag_depth);
+				declarations_prescanned_ = false;
+				while (!scan_namespace_declarations(window.substr(buffer_idx))) {
+					if (!source_) return;
+					std::size_t available = window.size() - buffer_idx;
+					if (buffer_idx == 0) buffer_size_ *= 2;
+					read_buffer();
+					if (window.size() - buffer_idx == available) return;
+				}
+			}
+			// Returns false, without declaring anything, if the tag doesn't end in tag. Malformed tags are left for next_attribute to report.
+			bool reader::scan_namespace_declarations(std::string_view tag) {
+				std::size_t idx = 0;
+				auto skip_ws = [&]() { while (idx < tag.size() && is_whitespace(tag[idx])) ++idx; return idx < tag.size(); };
+				pending_declarations_.clear(); //declared once the whole tag is found, so a tag that's cut off declares nothing twice
+				while (skip_ws() && tag[idx] != '>' && tag[idx] != '/') {
+					std::size_t name_begin = idx;
+					while (idx < tag.size() && is_name_char(tag[idx])) ++idx;
+					std::string_view name = tag.substr(name_begin, idx - name_begin);
+					if (!skip_ws()) return false;
+					if (name.empty() || tag[idx] != '=') break;
+					++idx;
+					if (!skip_ws()) return false;
+					char quote = tag[idx];
+					if (quote != '"' && quote != '\'') break;
+					std::size_t value_end = tag.find(quote, idx + 1);
+					if (value_end == std::string_view::npos) return false;
+					if (name.substr(0, 5) == "xmlns" && (name.size() == 5 || name[5] == ':'))
+						pending_declarations_.emplace_back(name, tag.substr(idx + 1, value_end - idx - 1));
+					idx = value_end + 1;
+				}
+				if (idx == tag.size()) return false;
+				declarations_prescanned_ = true;
+				for (auto [name, value] : pending_declarations_) {
+					if (value.find('&') != std::string_view::npos) {
+						declaration_scratch_.clear();
+						for (std::size_t i = 0; i < value.size(); ++i) {
+							std::size_t semicolon = value[i] == '&' ? value.find(';', i) : std::string_view::npos;
+							if (semicolon == std::string_view::npos || !decode_entity(value.substr(i + 1, semicolon - i - 1), declaration_scratch_))
+								declaration_scratch_.push_back(value[i]); //left for read_attr to report
+							else
+								i = semicolon;
+						}
+						value = declaration_scratch_;
+					}
+					declare_namespace(symbols_->intern(name), value);
+				}
+				if (dtd_.has_attribute_defaults()) { //and the defaulted xmlns attributes the tag doesn't have
+					for (const document_type::attribute_default& added : dtd_.attribute_defaults(tag_ids[position.tag_depth])) {
+						std::string_view name = symbols_->name(added.attribute);
+						if (name.substr(0, 5) != "xmlns" || (name.size() != 5 && name[5] != ':')) continue;
+						auto spelled = [&](const std::pair<std::string_view, std::string_view>& declaration) { return declaration.first == name; };
+						if (std::none_of(pending_declarations_.begin(), pending_declarations_.end(), spelled)) declare_namespace(added.attribute, added.value);
+					}
+				}
+				return true;
+			}
+			void reader::declare_namespace(symbol_id attribute, std::string_view value) {
+				const char* error = nullptr;
+				if (!namespaces_.declare_if_xmlns(position.tag_depth, attribute, value, *symbols_, error) && error != nullptr)
+					throw_malformed_xml(std::string(error) + ", in " + symbols_->name(attribute));
+			}
 			bool reader::read_close_tag() {
 				affirm_next_char('/', 0, "close tag must begin with /");
 				node.first = node_type::element_node;
-				read_name(node.second);
+				symbol_id close_id = read_symbol();
+				if (position.tag_depth == 0) throw_malformed_xml("close tag " + symbols_->name(close_id) + " without an open tag");
+				if (close_id != tag_ids[position.tag_depth - 1]) throw_malformed_xml("close tag " + symbols_->name(close_id) + " does not match open tag " + symbols_->name(tag_ids[position.tag_depth - 1]));
 				affirm_next_char('>', 0, "close tag must begin with /");
+				--position.tag_depth;
+				position.state = parse_state::after_node;
 				return false;
 			}
 			void reader::read_comment() {
 				assert(peek("!--"));
-				consume_nonws(3);
+				consume(3);
 				node.first = node_type::comment_node;
 				node.second.clear();
-				do {
-					while (buffer_idx < buffer.size()) {
-						if (peek("-->")) {
-							if (node.second[node.second.length()-1] == '-') throw_invalid_content("comment cannot contain --->");
-							consume_nonws(3);
-							return;
-						}
-						node.second.append(1, consume_maybe_ws());
-					}
-				} while (!at_eof());
+				if (append_until("-->")) {
+					if (!node.second.empty() && node.second.back() == '-') throw_invalid_content("comment cannot contain --->");
+					return;
+				}
 				throw_unexpeced_eof(); //TODO pass descriptions like above
 			}
 			void reader::append_cdata() {
 				assert(peek("<![CDATA["));
-				consume_nonws(9);
+				consume(9);
+				if (append_until("]]>")) return;
+				throw_unexpeced_eof();
+			}
+			bool reader::append_until(std::string_view terminator) {
+				do {
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, terminator[0]);
+					node.second.append(window.data() + buffer_idx, span);
+					consume(span);
+					if (span < remaining) {
+						if (peek(terminator.data(), terminator.size())) {
+							consume(terminator.size());
+							return true;
+						}
+						node.second.append(1, consume());
+					}
+				} while (buffer_idx < window.size() || !at_eof());
+				return false;
+			}
+			// As append_until, but discards the bytes.
+			bool reader::skip_until(std::string_view terminator) {
+				do {
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, terminator[0]);
+					consume(span);
+					if (span < remaining) {
+						if (peek(terminator.data(), terminator.size())) {
+							consume(terminator.size());
+							return true;
+						}
+						consume();
+					}
+				} while (buffer_idx < window.size() || !at_eof());
+				return false;
+			}
+			// Skips the rest of a tag, including its '>', stepping over quoted attribute values. Returns true if it was an empty element tag.
+			bool reader::skip_tag() {
+				char last = 0;
 				do {
-					while (buffer_idx < buffer.size()) {
-						if (peek("]]>")) {
-							consume_nonws(3);
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, '>', '"', '\'');
+					if (span > 0) last = window[buffer_idx + span - 1];
+					consume(span);
+					if (span < remaining) {
+						char c = consume();
+						if (c == '>') return last == '/';
+						if (!skip_until(std::string_view(&c, 1))) break;
+						last = c;
+					}
+				} while (buffer_idx < window.size() || !at_eof());
+				throw_unexpeced_eof("in a tag");
+			}
+			// Finds the matching close tag by scanning for '<' and counting depth, without decoding or interning anything.
+			// Only the final close tag's name is checked against the open tag. Comments, CDATA sections and processing
+			// instructions are stepped over whole, since they may contain unbalanced '<' and '>'.
+			void reader::skip_element() {
+				if (position.state != parse_state::after_tag_name 
+					&& position.state != parse_state::after_attribute 
+					&& position.state != parse_state::before_tag_finish)
+					throw_invalid_read_call("called skip_element, but not in a tag");
+				const symbol_id element_id = tag_ids[position.tag_depth];
+				position.state = parse_state::after_node;
+				if (skip_tag()) return;
+				std::size_t depth = 1;
+				do {
+					std::size_t remaining = window.size() - buffer_idx;
+					std::size_t span = find_first_of(window.data() + buffer_idx, remaining, '<');
+					consume(span);
+					if (span == remaining) continue;
+					consume();
+					char c = peek();
+					if (c == '/') {
+						consume();
+						if (--depth == 0) {
+							symbol_id close_id = read_symbol();
+							if (close_id != element_id) throw_malformed_xml("close tag " + symbols_->name(close_id) + " does not match open tag " + symbols_->name(element_id));
+							skip_ws();
+							affirm_next_char('>', 0, "close tag must end with >");
 							return;
 						}
-						node.second.append(1, consume_maybe_ws());
+						if (!skip_until(">")) break;
+					} 
+					else if (c == '?') { if (!skip_until("?>")) break; }
+					else if (peek("!--")) { if (!skip_until("-->")) break; }
+					else if (peek("![CDATA[")) { if (!skip_until("]]>")) break; }
+					else if (c == '!') { if (!skip_until(">")) break; }
+					else if (!skip_tag()) ++depth;
+				} while (buffer_idx < window.size() || !at_eof());
+				throw_unexpeced_eof("while skipping " + symbols_->name(element_id));
+			}
+			bool reader::open_root(const char* root_tag) {
+				if (source_) throw_invalid_read_call("parallel parsing needs a contiguous or memory mapped source in UTF-8");
+				if (position.state != parse_state::document_begin) throw_invalid_read_call("parallel parsing must start at the beginning of the document");
+				do {
+					if (!next_node()) throw_missing(node_type::element_node, root_tag);
+					if (node.first == node_type::string_node && !mpd::trim(node_value).empty()) throw_unexpected();
+				} while (node.first != node_type::element_node);
+				if (symbols_->name(tag_ids[0]) != root_tag) throw_unexpected("unexpected root element " + symbols_->name(tag_ids[0]));
+				begin_attributes();
+				while (next_attribute()) 
+					;
+				return finish_tag();
+			}
+			// A guess at where a record starts, since the pattern may also match inside a comment, CDATA section or attribute value.
+			std::uint64_t reader::find_record_start(std::string_view pattern, std::uint64_t from) const {
+				for (std::size_t idx = static_cast<std::size_t>(from); (idx = window.find(pattern, idx)) != std::string_view::npos; ++idx) {
+					std::size_t next = idx + pattern.size();
+					if (next < window.size() && (is_whitespace(window[next]) || window[next] == '>' || window[next] == '/'))
+						return idx;
+				}
+				return window.size();
+			}
+			// Workers start with a copy of the document's symbols, so that the DTD it read before the root, 
+			// and the namespaces the root declared, keep their ids.
+			void reader::inherit_prolog(const reader& document) {
+				symbols_ = std::make_shared<symbol_table>(*document.symbols_);
+				attribute_stamps.clear();
+				dtd_ = document.dtd_;
+				namespaces_enabled_ = document.namespaces_enabled_;
+				namespaces_ = document.namespaces_;
+			}
+			void reader::seek_root_content(std::uint64_t offset, symbol_id root_id) {
+				buffer_idx = static_cast<std::size_t>(offset);
+				position = parse_pos{ parse_state::after_node, 1 };
+				if (tag_ids.size() < 2) tag_ids.resize(2, no_symbol);
+				tag_ids[0] = root_id;
+			}
+			// Moves past records that were read by workers, and checks that only whitespace, comments and processing instructions follow the root.
+			void reader::finish_root(std::uint64_t offset) {
+				buffer_idx = static_cast<std::size_t>(offset);
+				position = parse_pos{ parse_state::after_node, 0 };
+				while (next_node()) {
+					if (node.first == node_type::element_node) throw_unexpected("unexpected root element " + symbols_->name(tag_ids[0]));
+					if (node.first == node_type::string_node && !mpd::trim(node_value).empty()) throw_unexpected();
+				}
+			}
+			// After the attributes in the tag, the declared defaults for the ones it didn't have, as if they had been in the tag.
+			bool reader::next_default_attribute() {
+				const std::vector<document_type::attribute_default>& defaults = dtd_.attribute_defaults(tag_ids[position.tag_depth]);
+				while (next_default_attribute_ < defaults.size()) {
+					const document_type::attribute_default& added = defaults[next_default_attribute_++];
+					if (added.attribute >= attribute_stamps.size()) attribute_stamps.resize(symbols_->size());
+					if (attribute_stamps[added.attribute] == attribute_generation) continue;
+					attribute_stamps[added.attribute] = attribute_generation;
+					attribute_id = added.attribute;
+					node_value = added.value;
+					position.state = parse_state::after_attribute;
+					if (namespaces_enabled_ && !declarations_prescanned_) declare_namespace(attribute_id, node_value);
+					return true;
+				}
+				return false;
+			}
+			void reader::require_ws(const char* message) {
+				if (!is_whitespace(peek())) throw_malformed_xml(message);
+				skip_ws();
+			}
+			// Leaves the literal's content in node.second.
+			void reader::read_literal() {
+				char quote = affirm_next_char('\"', '\'', "expected a quoted literal");
+				node.second.clear();
+				if (!append_until(std::string_view(&quote, 1))) throw_unexpeced_eof("in a quoted literal");
+			}
+			// SYSTEM "uri" or PUBLIC "id" "uri". The uri is optional after PUBLIC, for notations.
+			void reader::read_external_id() {
+				bool is_public = peek("PUBLIC");
+				consume(6);
+				require_ws("expected whitespace after SYSTEM or PUBLIC");
+				read_literal();
+				if (!is_public) return;
+				skip_ws();
+				char c = peek();
+				if (c == '"' || c == '\'') read_literal();
+			}
+			/*
+			<!DOCTYPE root SYSTEM "uri" [ internal subset ]>. The root name isn't checked, and the external subset isn't loaded.
+			The internal subset's general entities and attribute defaults are compiled into dtd_. Element declarations, notations,
+			and parameter entities are read and checked for well-formedness, but otherwise ignored, since nothing is validated.
+			*/
+			void reader::read_doctype() {
+				assert(peek("!DOCTYPE"));
+				if (position.tag_depth != 0 || tag_ids[0] != no_symbol || doctype_read_) throw_malformed_xml("a DOCTYPE may only come once, before the root element");
+				doctype_read_ = true;
+				consume(8);
+				require_ws("expected whitespace after DOCTYPE");
+				read_symbol();
+				skip_ws();
+				if (peek("SYSTEM") || peek("PUBLIC")) {
+					read_external_id();
+					skip_ws();
+				}
+				if (peek() == '[') {
+					consume();
+					read_internal_subset();
+					skip_ws();
+				}
+				affirm_next_char('>', 0, "DOCTYPE must end with >");
+			}
+			void reader::read_internal_subset() {
+				while (true) {
+					skip_ws();
+					char c = peek();
+					if (c == ']') {
+						consume();
+						return;
 					}
-				} while (!at_eof());
-				throw_unexpeced_eof();
+					if (c == '%') { //parameter entity references aren't expanded
+						consume();
+						read_symbol();
+						affirm_next_char(';', 0, "parameter entity reference must end with ;");
+						continue;
+					}
+					if (c != '<') throw_malformed_xml("expected a markup declaration in the DOCTYPE");
+					consume();
+					if (peek("!--")) read_comment();
+					else if (peek() == '?') read_processing_instruction();
+					else if (peek("!ENTITY")) read_entity_declaration();
+					else if (peek("!ATTLIST")) parse_attribute_list();
+					else if (peek("!ELEMENT")) read_element_type();
+					else if (peek("!NOTATION")) read_notation();
+					else if (peek("![")) read_conditional();
+					else throw_malformed_xml("invalid markup declaration in the DOCTYPE");
+				}
+			}
+			// <!ENTITY name "value">, <!ENTITY name SYSTEM "uri" NDATA notation>, or a parameter entity, <!ENTITY % name "value">
+			void reader::read_entity_declaration() {
+				consume(7);
+				require_ws("expected whitespace after ENTITY");
+				bool parameter = peek() == '%';
+				if (parameter) {
+					consume();
+					require_ws("expected whitespace after %");
+				}
+				symbol_id name = read_symbol();
+				require_ws("expected whitespace after the entity name");
+				std::string value;
+				bool external = peek("SYSTEM") || peek("PUBLIC");
+				if (external) {
+					read_external_id();
+					skip_ws();
+					if (peek("NDATA")) {
+						consume(5);
+						require_ws("expected whitespace after NDATA");
+						read_symbol();
+					}
+				}
+				else {
+					read_literal();
+					value = node.second;
+					if (value.find('%') != std::string::npos) throw_malformed_xml("parameter entity references aren't allowed inside declarations in the internal subset");
+					// Character references are replaced when the entity is declared, and entity references when it's used.
+					std::string decoded;
+					for (std::size_t idx = 0; idx < value.size(); ) {
+						std::size_t reference = value.find("&#", idx);
+						decoded.append(value, idx, reference == std::string::npos ? std::string::npos : reference - idx);
+						if (reference == std::string::npos) break;
+						std::size_t semicolon = value.find(';', reference);
+						if (semicolon == std::string::npos || !decode_entity(std::string_view(value).substr(reference + 1, semicolon - reference - 1), decoded))
+							throw_malformed_xml("invalid character reference in entity " + symbols_->name(name));
+						idx = semicolon + 1;
+					}
+					value = std::move(decoded);
+				}
+				skip_ws();
+				affirm_next_char('>', 0, "entity declaration must end with >");
+				if (!parameter) dtd_.declare_entity(name, std::move(value), external);
 			}
 			void reader::read_conditional() {
-				//TODO IMPLEMENT
-				throw_unexpected("Unimplemented read_conditional");
+				throw_malformed_xml("conditional sections are only allowed in the external subset");
 			}
+			// <!ATTLIST element attribute type default...>, where default is #REQUIRED, #IMPLIED, #FIXED "value" or "value".
+			// Types aren't checked, and values aren't normalized by type.
 			void reader::parse_attribute_list() {
-				//TODO IMPLEMENT
-				throw_unexpected("Unimplemented parse_attribute_list");
-			}
-			void reader::read_doctype() {
-				//TODO IMPLEMENT
-				throw_unexpected("Unimplemented read_doctype");
+				consume(8);
+				require_ws("expected whitespace after ATTLIST");
+				symbol_id element = read_symbol();
+				while (true) {
+					skip_ws();
+					if (peek() == '>') {
+						consume();
+						return;
+					}
+					symbol_id attribute = read_symbol();
+					require_ws("expected whitespace after the attribute name");
+					if (peek("NOTATION")) {
+						consume(8);
+						skip_ws();
+					}
+					if (peek() == '(') {
+						if (!skip_until(")")) throw_unexpeced_eof("in an attribute type");
+					}
+					else read_symbol();
+					require_ws("expected whitespace after the attribute type");
+					if (peek() == '#') {
+						consume();
+						if (peek("REQUIRED")) { consume(8); continue; }
+						if (peek("IMPLIED")) { consume(7); continue; }
+						if (!peek("FIXED")) throw_malformed_xml("expected #REQUIRED, #IMPLIED or #FIXED");
+						consume(5);
+						require_ws("expected whitespace after #FIXED");
+					}
+					read_literal();
+					std::string value = node.second;
+					std::string error;
+					if (!dtd_.expand_references(value, *symbols_, error)) throw_malformed_xml(error);
+					if (value.find('<') != std::string::npos) throw_invalid_content("attribute cannot contain <");
+					dtd_.declare_attribute_default(element, attribute, std::move(value));
+				}
 			}
+			// <!ELEMENT name content model>. Content models have no quoted literals, so the declaration ends at the first >.
 			void reader::read_element_type() {
-				//TODO IMPLEMENT
-				throw_unexpected("Unimplemented read_element_type");
+				if (!skip_until(">")) throw_unexpeced_eof("in an element declaration");
 			}
+			// <!NOTATION name SYSTEM "uri"> or <!NOTATION name PUBLIC "id" "uri">
 			void reader::read_notation() {
-				//TODO IMPLEMENT
-				throw_unexpected("Unimplemented read_notation");
+				consume(9);
+				require_ws("expected whitespace after NOTATION");
+				read_symbol();
+				require_ws("expected whitespace after the notation name");
+				if (!peek("SYSTEM") && !peek("PUBLIC")) throw_malformed_xml("expected SYSTEM or PUBLIC");
+				read_external_id();
+				skip_ws();
+				affirm_next_char('>', 0, "notation declaration must end with >");
 			}
 			void reader::read_processing_instruction() {
 				assert(peek("?"));
-				consume_nonws();
+				consume();
 				node.first = node_type::processing_node;
 				node.second.clear();
-				do {
-					while (buffer_idx < buffer.size()) {
-						if (peek("?>")) {
-							consume_nonws(2);
-							return;
-						}
-						node.second.append(1, consume_maybe_ws());
-					}
-				} while (!at_eof());
+				if (append_until("?>")) return;
 				throw_unexpeced_eof("unexpected eof in processing instruction " + node.second.substr(0, 20));
 			}
-			__forceinline char reader::consume_nonws() {
-				char c = buffer[buffer_idx];
-				++position.column;
-				++buffer_idx;
-				return c;
+			__forceinline char reader::consume() {
+				return window[buffer_idx++];
 			}
-			__forceinline void reader::consume_nonws(int count) {
-				position.column += count;
+			__forceinline void reader::consume(std::size_t count) {
 				buffer_idx += count;
 			}
-			__forceinline char reader::consume_maybe_ws() {
-				char c = buffer[buffer_idx];
-				if (buffer[buffer_idx] == '\n') {
-					position.line++;
-					position.column = 0;
-				} else if (buffer[buffer_idx] == '\r') {
-					//do not advance file position
-				} else 
-					position.column++;
-				++buffer_idx;
-				return c;
-			}
+			// Entity references are copied out of the window a span at a time, so that they may straddle a refill.
 			void reader::consume_escape(std::string& out) {
-				assert(buffer[buffer_idx] == '&');
-				consume_nonws();
-				if (buffer_idx + 11 > buffer.size()) read_buffer();
-				const char* deescape_ptr = buffer.data() + buffer_idx;
-				std::size_t in_bytes = 0;
-				int code_point = deescape(deescape_ptr, in_bytes);
-				if (code_point == '&') { // rarely can be nested, but only once
-					const char* deescape_ptr2 = buffer.data() + buffer_idx + in_bytes;
-					std::size_t in_bytes2 = 0;
-					code_point = deescape(deescape_ptr2, in_bytes2);
-					in_bytes += in_bytes;
-				}
-				if (code_point == -1) throw_malformed_xml(std::string(deescape_ptr, in_bytes) + " is not a recognized escape sequence");
-				append_utf8(code_point, out);
-				position.column += in_bytes;
-				buffer_idx += in_bytes;
+				assert(window[buffer_idx] == '&');
+				consume();
+				char reference[max_entity_length];
+				std::size_t length = 0;
+				do {
+					std::size_t available = std::min(window.size() - buffer_idx, max_entity_length - length);
+					std::size_t span = find_first_of(window.data() + buffer_idx, available, ';', '<', '&');
+					std::memcpy(reference + length, window.data() + buffer_idx, span);
+					length += span;
+					consume(span);
+					if (span < available) {
+						if (consume() != ';') throw_malformed_xml("&" + std::string(reference, length) + " is missing a ;");
+						if (dtd_.has_entities() && reference[0] != '#' && length != 0) {
+							std::string error;
+							symbol_id id = symbols_->find(std::string_view(reference, length));
+							if (id != no_symbol && dtd_.expand(id, out, *symbols_, error)) return;
+							if (!error.empty()) throw_malformed_xml(error);
+						}
+						if (!decode_entity(std::string_view(reference, length), out))
+							throw_malformed_xml("&" + std::string(reference, length) + "; is not a recognized escape sequence");
+						return;
+					}
+					if (length == max_entity_length) throw_malformed_xml("&" + std::string(reference, length) + " is not a recognized escape sequence");
+				} while (buffer_idx < window.size() || !at_eof());
+				throw_unexpeced_eof("in escape sequence &" + std::string(reference, length));
 			}
 			__forceinline char reader::peek() {
-				if (buffer_idx >= buffer.size()) {
+				if (buffer_idx >= window.size()) {
 					read_buffer();
-					if (buffer_idx >= buffer.size())
+					if (buffer_idx >= window.size())
 						throw_unexpeced_eof();
 				}
-				return buffer[buffer_idx];
+				return window[buffer_idx];
 			}
-			__forceinline char reader::peek(int offset) {
-				assert(buffer_idx + offset < BUFFER_SIZE);
-				if (buffer_idx+ offset >= buffer.size()) {
+			__forceinline char reader::peek(std::size_t offset) {
+				assert(offset < min_buffer_size);
+				if (buffer_idx+ offset >= window.size()) {
 					read_buffer();
-					if (buffer_idx + offset >= buffer.size())
+					if (buffer_idx + offset >= window.size())
 						throw_unexpeced_eof();
 				}
-				return buffer[buffer_idx+ offset];
+				return window[buffer_idx+ offset];
 			}
-			__forceinline bool reader::peek(const char* str, int len) {
-				assert(len < BUFFER_SIZE);
-				if (buffer_idx + len >= buffer.size()) {
+			__forceinline bool reader::peek(const char* str, std::size_t len) {
+				assert(len < min_buffer_size);
+				if (buffer_idx + len > window.size()) {
 					read_buffer();
-					if (buffer_idx + len >= buffer.size())
+					if (buffer_idx + len > window.size())
 						return false;
 				}
-				return strncmp(buffer.data() + buffer_idx, str, len) == 0;
+				return memcmp(window.data() + buffer_idx, str, len) == 0;
 			}
 			bool reader::at_eof() {
-				if (buffer_idx >= buffer.size()) {
+				if (buffer_idx >= window.size()) {
 					read_buffer();
-					return buffer.empty();
+					return buffer_idx >= window.size();
 				}
 				return false;
 			}
 			void reader::read_buffer() {
+				if (!source_) return; //contiguous sources are already entirely in the window
+				window_location = get_location(); //move the checkpoint past the bytes that are about to be discarded
+				window_offset += buffer_idx;
 				std::size_t keep_cnt = buffer.size() - buffer_idx;
 				if (keep_cnt > 0) std::move(buffer.begin() + buffer_idx, buffer.end(), buffer.begin());
-				if (buffer.size() != BUFFER_SIZE) buffer.resize(BUFFER_SIZE);
-				std::size_t desired_read_cnt = BUFFER_SIZE - 1 - keep_cnt;
-				std::size_t add_cnt = position.read_buf->read(buffer.data() + keep_cnt, desired_read_cnt);
-				if (add_cnt != BUFFER_SIZE) buffer.resize(keep_cnt + add_cnt);
+				if (buffer.size() != buffer_size_) buffer.resize(buffer_size_);
+				std::size_t desired_read_cnt = buffer_size_ - 1 - keep_cnt;
+				std::size_t add_cnt = source_->read(buffer.data() + keep_cnt, desired_read_cnt);
+				if (keep_cnt + add_cnt != buffer_size_) buffer.resize(keep_cnt + add_cnt);
+				window = buffer;
 				buffer_idx = 0;
 			}
+			// A UTF-8 byte order mark is skipped. Contiguous sources in other encodings can't be tokenized in place,
+			// so they're read through a transcoding_read_buf instead, in chunks of buffer_size_.
+			void reader::read_contiguous_encoding() {
+				std::size_t bom_length;
+				if (detect_encoding(window.substr(0, encoding_detect_size), bom_length) == encoding::utf8) {
+					window.remove_prefix(bom_length);
+					return;
+				}
+				source_.emplace(std::in_place_type_t<transcoding_read_buf<read_buf_impl<const char*>>>{}, window.data(), window.data() + window.size());
+				window = {};
+			}
+			void reader::rollback(const saved_pos& saved) {
+				if (saved.offset < window_offset) {
+					// A streaming source already discarded those bytes, so there is nothing to roll back to.
+					// Any further reads will throw invalid_read_call_error.
+					position.state = parse_state::unrecoverable;
+					return;
+				}
+				position = saved.position;
+				buffer_idx = static_cast<std::size_t>(saved.offset - window_offset);
+			}
+
+			std::size_t istream_read_buf::read(char* buffer, std::size_t count) {
+				stream_->read(buffer, static_cast<std::streamsize>(count));
+				if (stream_->bad()) throw std::ios_base::failure("error reading from stream");
+				return static_cast<std::size_t>(stream_->gcount());
+			}
+			std::size_t file_read_buf::read(char* buffer, std::size_t count) {
+				std::size_t read_cnt = std::fread(buffer, 1, count, file_);
+				if (read_cnt < count && std::ferror(file_)) throw std::system_error(errno, std::generic_category(), "error reading from FILE");
+				return read_cnt;
+			}
+			std::size_t fd_read_buf::read(char* buffer, std::size_t count) {
+				std::size_t total = 0;
+				while (total < count) { //pipes and sockets return short reads, so keep going until the buffer is full or eof
+#ifdef _WIN32
+					int read_cnt = ::_read(fd_, buffer + total, static_cast<unsigned int>(std::min<std::size_t>(count - total, INT_MAX)));
+#else
+					ssize_t read_cnt = ::read(fd_, buffer + total, count - total);
+					if (read_cnt < 0 && errno == EINTR) continue;
+#endif
+					if (read_cnt < 0) throw std::system_error(errno, std::generic_category(), "error reading from file descriptor");
+					if (read_cnt == 0) break;
+					total += static_cast<std::size_t>(read_cnt);
+				}
+				return total;
+			}
 		}
 	}
 }
\ No newline at end of file
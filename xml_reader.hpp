@@ -1,13 +1,17 @@
 #pragma once
 #define _CRT_NONSTDC_NO_DEPRECATE
 #include "type_erased.hpp"
+#include "xml_mapped_file.hpp"
+#include "xml_symbols.hpp"
 #include <cassert>
 #include <cctype>
 #include <climits>
 #include <cstring>
 #include <algorithm>
 #include <iterator>
+#include <memory_resource>
 #include <functional>
+#include <initializer_list>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -22,17 +26,16 @@
 
 namespace mpd {
 	static inline std::string_view ltrim(std::string_view s) {
-		std::string_view::const_iterator last = std::find_if(s.begin(), s.end(), [](int ch) {
+		std::string_view::const_iterator first = std::find_if(s.begin(), s.end(), [](unsigned char ch) {
 			return !std::isspace(ch);
 		});
-		return std::string_view(s.data(), last - s.begin());
+		return s.substr(first - s.begin());
 	}
 	static inline std::string_view rtrim(std::string_view s) {
-		std::string_view::const_reverse_iterator first = std::find_if(s.rbegin(), s.rend(), [](int ch) {
-			return std::isspace(ch);
+		std::string_view::const_reverse_iterator last = std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) {
+			return !std::isspace(ch);
 		});
-		std::size_t drop = first.base() - s.begin();
-		return std::string_view(s.data() + drop, s.length() - drop);
+		return s.substr(0, last.base() - s.begin());
 	}
 	static inline std::string_view trim(std::string_view s) {
 		return ltrim(rtrim(s));
@@ -54,7 +57,11 @@ namespace mpd {
 		Node - An Element, Whitespace, String, Comment, CDATA, or Processing Instruction.
 
 		To begin, construct a mpd::xml::document_reader from a filename and bidirectional iterators
-		for the content. Then one normally calls document_reader#read_document and passes in a 
+		for the content. If the iterators are over contiguous chars (char*, std::string, std::vector<char>),
+		or if you pass a std::string_view, the content is parsed in place without copying, and must 
+		outlive the document_reader. You may also construct it from a file path, and the file will be
+		memory mapped and parsed in place. Or construct it from a std::istream, FILE*, or file descriptor,
+		which are read in bulk through a refill window whose size you may choose per document_reader. Then one normally calls document_reader#read_document and passes in a 
 		document_parser_t, and the method will return the fully parsed document. Alternatively,
 		if all you care about is the only Element, you may call document_reader#element_document,
 		passing a tag name and a element_parser_t, returning the parsed Element directly.
@@ -80,6 +87,9 @@ namespace mpd {
 
 			// Called right before an element contains a tag.
 			// This is useful for resetting all state, between parsed elements.
+			// Parents keep one instance of each child parser, and it's reset and reused for every sibling, so reset
+			// should clear containers rather than replace them, to keep their capacity. end_parse may then
+			// hand the contents back with mpd::xml::move_out(container), which leaves the capacity with the parser.
 			void reset()
 			{ }
 
@@ -105,6 +115,11 @@ namespace mpd {
 			// One normal implementation is shown below, that throws if an attribute is encountered.
 			void parse_attribute(attribute_reader& reader, const std::string& name, std::string&& value)
 			{ reader.throw_unexpected(); }
+			// Alternatively, a parser may opt in to receiving the value as a std::string_view, which avoids
+			// allocating a string for each attribute. If the value had no escapes, the view is directly into
+			// the input, otherwise it's into a decoded copy. Either way it's only valid until this method returns.
+			void parse_attribute(attribute_reader& reader, const std::string& name, std::string_view value)
+			{ reader.throw_unexpected(); }
 
 			// Called when a Tag is complete and we're about to parse children.
 			// This is rarely useful, but can be handy if you do not know the most derived type until
@@ -137,6 +152,9 @@ namespace mpd {
 				if (type != node_type::string_node || mpd::trim(content).size()>0)
 					reader.throw_unexpected();
 			}
+			// As with parse_attribute, a parser may instead opt in to receiving a std::string_view, 
+			// which is only valid until this method returns.
+			void parse_child_node(base_reader& reader, node_type type, std::string_view content, ...);
 			// This is called when the close Tag is reached, and the element is fully parsed.
 			// Usually this returns a fully parsed object to the child_parser_t#parse_tag method. 
 			// Presumably this should return the parsed type, but can return a builder or similar, as 
@@ -218,6 +236,17 @@ namespace mpd {
 			//You can call this to throw a invalid_content with the current line number and offset and such.
 			[[noreturn]] void throw_invalid_content(const char* details = nullptr);
 			[[noreturn]] void throw_invalid_content(const std::string& details) { throw_invalid_content(details.c_str()); }
+			//The interned id of the current tag name (in parse_tag, parse_child_element, and parse_content)
+			//or attribute name (in parse_attribute). Compare against ids from symbols().intern(...) to avoid string compares.
+			symbol_id name_id();
+			//With namespaces enabled, the interned URI of the current tag or attribute name's namespace, or no_symbol if it has none.
+			//Unprefixed attributes have no namespace. Throws malformed_xml if the prefix isn't declared.
+			symbol_id namespace_id();
+			//The interned current tag or attribute name without its prefix. Compare (namespace_id(), local_name_id()) to match names by namespace.
+			symbol_id local_name_id();
+			symbol_table& symbols();
+			//The resource that parsed results should be allocated from. See document_reader#use_memory_resource
+			std::pmr::memory_resource* memory_resource();
 			base_reader(const base_reader&) = delete;
 			base_reader& operator=(const base_reader&) = delete;
 		protected:
@@ -229,6 +258,8 @@ namespace mpd {
 		public:
 			template<class element_parser_t, class...Args> 
 			typename std::remove_reference_t<element_parser_t>::element_type read_element(element_parser_t&& parser, Args&&...args);
+			// Alternatively, skips the whole element without tokenizing it. Only the matching close tag's name is checked.
+			void skip_element();
 		protected:
 			tag_reader(impl::reader& reader) :base_reader(reader) {}
 		};
@@ -250,15 +281,29 @@ namespace mpd {
 #include "xml_reader_impl.hpp"
 namespace mpd {
 	namespace xml {
+		inline std::string base_reader::get_location_for_exception()
+		{ return reader_->get_location_for_exception(); }
 		inline void base_reader::throw_unexpected(const char * details)
 		{ reader_->throw_unexpected(details); }
 		inline void base_reader::throw_missing(node_type type, const char * name, const char * details)
 		{ reader_->throw_missing(type, name, details); }
 		inline void base_reader::throw_invalid_content(const char * details)
 		{ reader_->throw_invalid_content(details); }
+		inline symbol_id base_reader::name_id()
+		{ return reader_->name_id(); }
+		inline symbol_id base_reader::namespace_id()
+		{ return reader_->namespace_id(); }
+		inline symbol_id base_reader::local_name_id()
+		{ return reader_->local_name_id(); }
+		inline symbol_table& base_reader::symbols()
+		{ return reader_->symbols(); }
+		inline std::pmr::memory_resource* base_reader::memory_resource()
+		{ return reader_->memory_resource(); }
 		template<class element_parser_t, class...Args>
 		inline typename std::remove_reference_t<element_parser_t>::element_type tag_reader::read_element(element_parser_t&& parser, Args&&...args)
 		{ return reader_->read_element(parser, args...); } //deliberately not using std::forward
+		inline void tag_reader::skip_element()
+		{ reader_->skip_element(); }
 		template<class element_parser_t>
 		inline typename std::remove_reference_t<element_parser_t>::element_type element_reader::read_child(element_parser_t&& parser)
 		{ return reader_->call_parse_tag(parser); }
@@ -266,25 +311,36 @@ namespace mpd {
 		struct IgnoredXmlParser {
 			using element_type = std::nullptr_t;
 			void reset() {}
-			std::nullptr_t parse_tag(tag_reader& reader, const std::string&) { return reader.read_element(*this); }
-			void parse_attribute(attribute_reader&, const std::string&, std::string) {}
+			std::nullptr_t parse_tag(tag_reader& reader, const std::string&) { reader.skip_element(); return nullptr; }
+			void parse_attribute(attribute_reader&, const std::string&, std::string_view) {}
 			IgnoredXmlParser parse_content(base_reader&) { return *this; }
 			void parse_child_element(element_reader& reader, const std::string& ) {reader.read_child(*this); }
-			void parse_child_node(base_reader&, node_type, std::string&&) { }
+			void parse_child_node(base_reader&, node_type, std::string_view) { }
 			std::nullptr_t end_parse(base_reader&) { return nullptr; }
 		};
 
+		// Returns a container holding the elements of scratch, moved, in one exactly sized allocation, 
+		// and leaves scratch empty but with its capacity, to be filled again by the next sibling.
+		template<class Container>
+		Container move_out(Container& scratch) {
+			Container result(std::make_move_iterator(scratch.begin()), std::make_move_iterator(scratch.end()), scratch.get_allocator());
+			scratch.clear();
+			return result;
+		}
+
 		template<class element_parser_t>
 		struct document_root_parser {
 			using element_type = typename std::remove_reference_t<element_parser_t>::element_type;
 			void reset() { child.reset(); }
 			void parse_child_element(element_reader& reader, const std::string& tag) {
-				if ((tag == child_tag_ || child_tag_==nullptr) && !child.has_value())
+				if (child_tag_ != nullptr && child_id_ == no_symbol) child_id_ = reader.symbols().intern(child_tag_);
+				if ((child_tag_ == nullptr || reader.name_id() == child_id_) && !child.has_value())
 					child.emplace(reader.read_child(child_parser_));
 				else reader.throw_unexpected("unexpected root element " + tag);
 			}
-			void parse_child_node(base_reader& reader, node_type type, std::string&& content) {
-				if (type != node_type::string_node || mpd::trim(content).size()>0)
+			// The xml declaration, other processing instructions, and comments may surround the root element.
+			void parse_child_node(base_reader& reader, node_type type, std::string_view content) {
+				if (type == node_type::string_node && mpd::trim(content).size()>0)
 					reader.throw_unexpected();
 			}
 			element_type end_parse(base_reader&) { return std::move(child).value(); }
@@ -294,25 +350,143 @@ namespace mpd {
 			document_root_parser& operator=(const document_root_parser&) = delete;
 		private:
 			const char* child_tag_;
+			symbol_id child_id_ = no_symbol;
 			element_parser_t child_parser_;
 			std::optional<element_type> child;
 		};
 
+		// Descends the elements named by path, and passes each parsed child of the last one to on_child as soon as its close tag is read.
+		// Siblings that are not on the path are skipped, so memory stays bounded by the largest single child.
+		template<class child_parser_t, class callback_t>
+		struct streaming_children_parser {
+			using element_type = std::size_t;
+			void reset() {}
+			std::size_t parse_tag(tag_reader& reader, const std::string&) { return reader.read_element(*this); }
+			void parse_attribute(attribute_reader&, const std::string&, std::string_view) {}
+			streaming_children_parser& parse_content(base_reader&) { return *this; }
+			void parse_child_element(element_reader& reader, const std::string& tag) {
+				if (path_ids_.empty()) {
+					for (const char* name : path_) path_ids_.push_back(reader.symbols().intern(name));
+					if (child_tag_ != nullptr) child_id_ = reader.symbols().intern(child_tag_);
+				}
+				symbol_id id = reader.name_id();
+				if (level_ == 0 && (root_found_ || id != path_ids_[0])) reader.throw_unexpected("unexpected root element " + tag);
+				if (level_ < path_ids_.size()) {
+					if (id != path_ids_[level_]) {
+						reader.read_child(IgnoredXmlParser{});
+						return;
+					}
+					root_found_ = true;
+					++level_;
+					reader.read_child(*this);
+					--level_;
+				}
+				else if (child_tag_ == nullptr || id == child_id_) {
+					on_child_(reader.read_child(child_parser_));
+					++count_;
+				}
+				else reader.read_child(IgnoredXmlParser{});
+			}
+			void parse_child_node(base_reader& reader, node_type type, std::string_view content) {
+				if (level_ == 0 && type == node_type::string_node && mpd::trim(content).size()>0)
+					reader.throw_unexpected();
+			}
+			std::size_t end_parse(base_reader& reader) { 
+				if (level_ == 0 && !root_found_) reader.throw_missing(node_type::element_node, *path_.begin());
+				return count_; 
+			}
+			streaming_children_parser(std::initializer_list<const char*> path, const char* child_tag, child_parser_t& child_parser, callback_t& on_child)
+				: path_(path), child_tag_(child_tag), child_parser_(child_parser), on_child_(on_child) {}
+			streaming_children_parser(const streaming_children_parser&) = delete;
+			streaming_children_parser& operator=(const streaming_children_parser&) = delete;
+		private:
+			std::initializer_list<const char*> path_;
+			const char* child_tag_;
+			child_parser_t& child_parser_;
+			callback_t& on_child_;
+			std::vector<symbol_id> path_ids_;
+			symbol_id child_id_ = no_symbol;
+			std::size_t level_ = 0;
+			bool root_found_ = false;
+			std::size_t count_ = 0;
+		};
+
 		struct document_reader {
-			template<class forward_it>
-			explicit document_reader(std::string&& source_name, forward_it begin, forward_it end)
-				:reader_(std::move(source_name), std::in_place_type_t<impl::read_buf_impl<forward_it>>{}, begin, end) 
-{}
+			// buffer_size is the size of the refill window for sources that are not parsed in place.
+			// Sources may be in UTF-8, UTF-16, ISO-8859-1 or windows-1252, as a byte order mark or the xml declaration says.
+			// Sources in other than UTF-8 are converted to UTF-8 as they're read, even those that would be parsed in place,
+			// and locations in exceptions are offsets into the converted UTF-8.
+			// Not for integers, so that (source_name, fd, buffer_size) reads the file descriptor.
+			template<class forward_it, std::enable_if_t<!std::is_integral_v<forward_it>, bool> = true>
+			explicit document_reader(std::string&& source_name, forward_it begin, forward_it end, std::size_t buffer_size = impl::default_buffer_size)
+				:document_reader(impl::is_contiguous_char_iterator<forward_it>{}, std::move(source_name), begin, end, buffer_size) 
+			{}
+			// content must outlive the document_reader, as it is parsed in place.
+			explicit document_reader(std::string&& source_name, std::string_view content)
+				:reader_(std::move(source_name), content)
+			{}
+			// Memory maps the file, and parses the mapping in place.
+			explicit document_reader(const std::filesystem::path& path)
+				:file_(path)
+				, reader_(path.string(), file_.view())
+			{}
+			// These sources are read in bulk, and must outlive the document_reader.
+			explicit document_reader(std::string&& source_name, std::istream& stream, std::size_t buffer_size = impl::default_buffer_size)
+				:reader_(std::move(source_name), buffer_size, std::in_place_type_t<impl::transcoding_read_buf<impl::istream_read_buf>>{}, stream)
+			{}
+			explicit document_reader(std::string&& source_name, std::FILE* file, std::size_t buffer_size = impl::default_buffer_size)
+				:reader_(std::move(source_name), buffer_size, std::in_place_type_t<impl::transcoding_read_buf<impl::file_read_buf>>{}, file)
+			{}
+			explicit document_reader(std::string&& source_name, int fd, std::size_t buffer_size = impl::default_buffer_size)
+				:reader_(std::move(source_name), buffer_size, std::in_place_type_t<impl::transcoding_read_buf<impl::fd_read_buf>>{}, fd)
+			{}
 			document_reader(const document_reader& nocopy) = delete;
 			document_reader& operator=(const document_reader& nocopy) = delete;
+			// Element and attribute names are interned in a symbol_table. By default each document_reader has its own,
+			// but one may be shared across document_readers before reading, so that symbol ids are the same for all of them.
+			const std::shared_ptr<symbol_table>& symbols() const { return reader_.shared_symbols(); }
+			void share_symbols(std::shared_ptr<symbol_table> symbols) { reader_.share_symbols(std::move(symbols)); }
+			// The reader's buffers, and results built by the std parsers and builder parsers for allocator aware types
+			// (such as those in mpd::xml::pmr), are allocated from resource rather than the global heap. For example a 
+			// std::pmr::monotonic_buffer_resource, so that a whole document is freed at once. The resource must outlive 
+			// the document_reader and the results, and can only be changed before reading.
+			void use_memory_resource(std::pmr::memory_resource* resource) { reader_.use_memory_resource(resource); }
+			// Tracks xmlns declarations, so parsers and cursors can get each name's namespace with namespace_id().
+			// Prefixes are resolved when declared, so the cost per element is a scan of its start tag for declarations.
+			// Can only be enabled before reading.
+			void enable_namespaces() { reader_.enable_namespaces(); }
+			// The entities declared in a DOCTYPE's internal subset are expanded at most max_depth levels deep,
+			// into at most max_bytes in total across the document, after which reading throws malformed_xml.
+			// External entities are never loaded. The defaults are 16 levels, and 16MB.
+			void limit_entity_expansion(std::size_t max_depth, std::uint64_t max_bytes) { reader_.limit_entity_expansion(max_depth, max_bytes); }
 			template<class document_parser_t> 
 			typename std::remove_reference_t<document_parser_t>::element_type read_document(document_parser_t&& parser) 
 			{ return reader_.read_contents(parser); }
+			// The parser is used in place rather than copied, so one parser may be passed to several documents and keep its capacity.
 			template<class element_parser_t> 
 			typename std::remove_reference_t<element_parser_t>::element_type read_child(const char* tag, element_parser_t&& parser)
-			{ return reader_.read_contents(document_root_parser(tag, parser)); }
+			{ return reader_.read_contents(document_root_parser<std::remove_reference_t<element_parser_t>&>(tag, parser)); }
+			// Rather than returning every child at once, calls on_child(child) for each child of the element at path 
+			// (the root's name, then the names of its descendants) as soon as the child is parsed, and returns how many there were. 
+			// If child_tag is not null, other children are skipped. This reads a document of any size in memory bounded by one child.
+			template<class child_parser_t, class callback_t>
+			std::size_t for_each_child(std::initializer_list<const char*> path, const char* child_tag, child_parser_t&& parser, callback_t&& on_child) {
+				if (path.size() == 0) reader_.throw_invalid_read_call("for_each_child needs at least the root element's name");
+				return reader_.read_contents(streaming_children_parser<std::remove_reference_t<child_parser_t>, std::remove_reference_t<callback_t>>(path, child_tag, parser, on_child)); 
+			}
 		private:
+			template<class contiguous_it>
+			document_reader(std::true_type, std::string&& source_name, contiguous_it begin, contiguous_it end, std::size_t)
+				:reader_(std::move(source_name), impl::make_contiguous_view(begin, end))
+			{}
+			template<class forward_it>
+			document_reader(std::false_type, std::string&& source_name, forward_it begin, forward_it end, std::size_t buffer_size)
+				:reader_(std::move(source_name), buffer_size, std::in_place_type_t<impl::transcoding_read_buf<impl::read_buf_impl<forward_it>>>{}, begin, end)
+			{}
+			impl::mapped_file file_; //must be declared before reader_, since reader_ points into it
 			impl::reader reader_;
+			friend cursor;
+			friend impl::parallel_records;
 
 		};
 
@@ -1,15 +1,29 @@
 #pragma once
 #define _CRT_NONSTDC_NO_DEPRECATE
 #include "type_erased.hpp"
+#include "xml_dtd.hpp"
+#include "xml_encoding.hpp"
+#include "xml_entities.hpp"
+#include "xml_namespaces.hpp"
+#include "xml_scan.hpp"
+#include "xml_symbols.hpp"
 #include <cassert>
+#include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <functional>
+#include <istream>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #ifdef _MSC_VER 
 #define noinline(RETURN) __declspec(noinline) RETURN
@@ -20,37 +34,83 @@
 namespace mpd {
 	namespace xml {
 		struct document_reader;
+		class cursor;
+		namespace impl { struct parallel_records; struct push_reader_members; }
 		namespace impl {
 			template<typename T> struct identity { typedef T type; };
 
+#ifdef _DEBUG
+			static constexpr std::size_t default_buffer_size = 15; //tiny, so that debug builds exercise the refill paths
+#else 
+			static constexpr std::size_t default_buffer_size = 64 * 1024;
+#endif
+			static constexpr std::size_t min_buffer_size = 15; //the tokenizer never peeks further ahead than this
+
 			struct read_buf_t {
 				virtual read_buf_t* copy_construct_at(char* buffer, std::size_t buffer_size)const& = 0;
 				virtual read_buf_t* move_construct_at(char* buffer, std::size_t buffer_size) & = 0;
 				virtual ~read_buf_t() {};
-				virtual int read(char* buffer, int count) = 0;
+				virtual std::size_t read(char* buffer, std::size_t count) = 0;
+				// True if a short read means the input isn't available yet, rather than that it has ended.
+				virtual bool more_input() const { return false; }
 			};
 
+			// Detects the opt-in string_view parser contracts, which receive values as views rather than owned strings.
+			template<class always_void, template<class...> class op, class...Ts> struct detect : std::false_type {};
+			template<template<class...> class op, class...Ts> struct detect<std::void_t<op<Ts...>>, op, Ts...> : std::true_type {};
+			template<class tag_parser_t, class...Args>
+			using parse_attribute_view_t = decltype(std::declval<tag_parser_t&>().parse_attribute(std::declval<attribute_reader&>(), std::declval<const std::string&>(), std::declval<std::string_view>(), std::declval<Args&>()...));
+			template<class element_parser_t, class...Args>
+			using parse_child_node_view_t = decltype(std::declval<element_parser_t&>().parse_child_node(std::declval<base_reader&>(), std::declval<node_type>(), std::declval<std::string_view>(), std::declval<Args&>()...));
+
 			class reader : public tag_reader, attribute_reader, element_reader {
-				enum class parse_state { document_begin, after_tag_name, after_attribute, before_tag_finish, after_open_tag, after_node, document_end };
+				enum class parse_state { document_begin, after_tag_name, after_attribute, before_tag_finish, after_open_tag, after_node, document_end, unrecoverable };
 				struct parse_pos {
-					type_erased<read_buf_t> read_buf;
-					std::size_t line = 0;
-					std::size_t column = 0;
 					parse_state state = parse_state::document_begin;
-					std::string tag_name;
-
-					template<class read_buff_t, class...Us>
-					parse_pos(std::in_place_type_t<read_buff_t> name, Us&&...us) :read_buf(name, std::forward<Us>(us)...) {}
+					std::size_t tag_depth = 0; //number of open elements
 				} position;
+				// Everything needed to roll back to an earlier point. Trivially copyable, so it's cheap to take one for every element.
+				struct saved_pos {
+					parse_pos position;
+					std::uint64_t offset;
+				};
+				type_erased<read_buf_t> source_; //null for contiguous sources
+				std::shared_ptr<symbol_table> symbols_;
+				std::pmr::memory_resource* resource_ = std::pmr::get_default_resource(); //for the buffers below, and for parsed results
+				std::pmr::vector<symbol_id> tag_ids; //the last tag name read at each depth. Never decreases in size to avoid repeated allocations
 				std::string source_name_;
 				std::pair<node_type, std::string> node;
-				std::string buffer;
+				std::string_view node_value; //the current attribute value or node content. Views the window when it had no escapes, otherwise node.second.
+				std::pmr::string buffer; //staging for read_buf sources. Unused for contiguous sources.
+				std::size_t buffer_size_ = default_buffer_size;
+				std::string_view window; //the bytes being tokenized. Either buffer, or the entire contiguous source.
 				std::size_t buffer_idx = 0;
-				std::size_t escape_end_idx = 0;
-				std::vector<std::string> attribute_set; //never decreases in size to avoid repeated allocations
-				std::size_t attribute_count;
+				std::uint64_t window_offset = 0; //offset of window[0] in the source
+			public:
+				// Line and column are not tracked while tokenizing. They're counted from the checkpoint on demand.
+				struct location {
+					std::uint64_t offset = 0;
+					std::size_t line = 0;
+					std::size_t column = 0;
+				};
+			private:
+				location checkpoint; //never after the current position, except briefly after a rollback
+				location window_location; //the location of window[0]
+				symbol_id attribute_id = no_symbol; //the last attribute name read
+				std::pmr::vector<std::uint32_t> attribute_stamps; //indexed by symbol_id. Equal to attribute_generation if the attribute was already in this tag.
+				std::uint32_t attribute_generation = 0;
+				std::pmr::string name_scratch; //for names split across a refill
+				bool namespaces_enabled_ = false;
+				bool declarations_prescanned_ = false; //the current start tag's xmlns attributes were declared when its name was read
+				namespace_scopes namespaces_;
+				std::vector<std::pair<std::string_view, std::string_view>> pending_declarations_; //xmlns attributes found by scan_namespace_declarations
+				std::string declaration_scratch_; //for xmlns values with escapes
+				document_type dtd_; //from the DOCTYPE's internal subset
+				bool doctype_read_ = false;
+				std::size_t next_default_attribute_ = 0; //the next of the current tag's declared attribute defaults to check
 			public:
 				//Get the current Location
+				location get_location();
 				std::string get_location_for_exception();
 				//You can call this to throw a unexpected_node with the current line number and offset and such.
 				[[noreturn]] void throw_unexpected(const char* details = nullptr);
@@ -61,6 +121,22 @@ namespace mpd {
 				//You can call this to throw a invalid_content with the current line number and offset and such.
 				[[noreturn]] void throw_invalid_content(const char* details = nullptr);
 				[[noreturn]] void throw_invalid_content(const std::string& details) { throw_invalid_content(details.c_str()); }
+				// The symbol for the current tag or attribute name, or no_symbol between tags.
+				symbol_id name_id() const;
+				symbol_table& symbols() { return *symbols_; }
+				const std::shared_ptr<symbol_table>& shared_symbols() const { return symbols_; }
+				void share_symbols(std::shared_ptr<symbol_table> symbols);
+				std::pmr::memory_resource* memory_resource() const { return resource_; }
+				void use_memory_resource(std::pmr::memory_resource* resource);
+				void enable_namespaces();
+				bool namespaces_enabled() const { return namespaces_enabled_; }
+				// The namespace of the current tag or attribute name, or no_symbol if it has none. Requires enable_namespaces.
+				symbol_id namespace_id();
+				// The namespace of name, as an element or attribute name in the current element.
+				symbol_id resolve_namespace(symbol_id name, bool attribute);
+				// The current tag or attribute name without its prefix.
+				symbol_id local_name_id();
+				void limit_entity_expansion(std::size_t max_depth, std::uint64_t max_bytes) { dtd_.limit_expansion(max_depth, max_bytes); }
 			private:
 				struct post_condition {
 					reader& reader_;
@@ -68,8 +144,10 @@ namespace mpd {
 					const char* message_;
 					post_condition(reader* reader, parse_state desired, const char* message)
 						:reader_(*reader), desired_(desired), message_(message) {}
-					~post_condition() {
-						if (!std::uncaught_exceptions() && reader_.position.state != desired_)
+					// Destructors are noexcept by default, which would turn a parser's mistake into std::terminate. 
+					// A parser that caught an unrecoverable error isn't at fault, and the next read call throws instead.
+					~post_condition() noexcept(false) {
+						if (!std::uncaught_exceptions() && reader_.position.state != desired_ && reader_.position.state != parse_state::unrecoverable)
 							reader_.throw_invalid_parser(message_);
 					}
 				};
@@ -82,27 +160,29 @@ namespace mpd {
 			public:
 				template<class child_parser_t, class...Args>//, typename identity<decltype(tag_parser_t::parse_tag)>::type = 0>
 				typename std::remove_reference_t<child_parser_t>::element_type call_parse_tag(child_parser_t& parser, Args&&...args) {
+					require_recoverable();
 					call_reset_parser(parser);
 					post_condition condition(this, parse_state::after_node, "parser.parse_tag must call reader.read_element");
-					return parser.parse_tag(static_cast<tag_reader&>(*this), position.tag_name, args...);
+					return parser.parse_tag(static_cast<tag_reader&>(*this), symbols_->name(tag_ids[position.tag_depth]), args...);
 				}
 				template<class tag_parser_t, class...Args> 
 				typename std::remove_reference_t<tag_parser_t>::element_type read_element(tag_parser_t&& parser, Args&&...args) {
+					require_recoverable();
 					if (position.state != parse_state::after_tag_name) throw_invalid_read_call("called read_element, but not at the beginning of a tag");
-					parse_pos saved_pos(position);
+					saved_pos saved = save_position();
 					try {
-						attribute_count = 0;
+						begin_attributes();
 						while (next_attribute())
 							call_parse_attribute(parser, args...);
 						return read_contents(call_parse_content(parser, args...), args...);
 					}
 					catch (const std::exception&) {
-						position = std::move(saved_pos);
-						buffer.clear();
-						buffer_idx = 0;
+						rollback(saved);
 						throw;
 					}
 				}
+				// Skips the element whose tag is being read, instead of read_element.
+				void skip_element();
 			protected:
 				template<class element_parser_t, class...Args> 
 				typename std::remove_reference_t<element_parser_t>::element_type read_contents(element_parser_t&& parser, Args&&...args) {
@@ -110,7 +190,7 @@ namespace mpd {
 						&& position.state != parse_state::before_tag_finish
 						&& position.state != parse_state::after_node)
 						throw_invalid_read_call("called readDocument from invalid call location");
-					parse_pos saved_pos(position);
+					saved_pos saved = save_position();
 					try {
 						while (next_node()) {
 							if (node.first == node_type::element_node) call_parse_child_element(parser, args...);
@@ -119,9 +199,7 @@ namespace mpd {
 						return parser.end_parse(static_cast<attribute_reader&>(*this), args...);
 					}
 					catch (const std::exception&) {
-						position = std::move(saved_pos);
-						buffer.clear();
-						buffer_idx = 0;
+						rollback(saved);
 						throw;
 					}
 				}
@@ -129,74 +207,143 @@ namespace mpd {
 				template<class tag_parser_t, class...Args>
 				void call_parse_attribute(tag_parser_t& parser, Args&&...args) {
 					post_condition condition(this, parse_state::after_attribute, "parser.parse_attribute somehow did something invalid"); 
-					parser.parse_attribute(static_cast<attribute_reader&>(*this), const_cast<const std::string&>(attribute_set[attribute_count-1]), std::move(node.second), args...);
+					if constexpr (detect<void, parse_attribute_view_t, tag_parser_t, Args...>::value)
+						parser.parse_attribute(static_cast<attribute_reader&>(*this), symbols_->name(attribute_id), node_value, args...);
+					else
+						parser.parse_attribute(static_cast<attribute_reader&>(*this), symbols_->name(attribute_id), std::move(owned_node_value()), args...);
 				}
 				template<class element_parser_t, class...Args>
 				void call_parse_child_element(element_parser_t& parser, Args&&...args) {
 					post_condition condition(this, parse_state::after_node, "parser.parse_child_element should have called reader.read_element(ChildParserType{})");
-					parser.parse_child_element(static_cast<element_reader&>(*this), position.tag_name, args...);
+					parser.parse_child_element(static_cast<element_reader&>(*this), symbols_->name(tag_ids[position.tag_depth]), args...);
 				}
 				template<class element_parser_t, class...Args>
 				void call_parse_child_node(element_parser_t& parser, Args&&...args) {
 					post_condition condition(this, position.state, "parser.parse_child_node somehow did something invalid");
-					parser.parse_child_node(static_cast<base_reader&>(static_cast<attribute_reader&>(*this)), node.first, std::move(node.second), args...);
+					if constexpr (detect<void, parse_child_node_view_t, element_parser_t, Args...>::value)
+						parser.parse_child_node(static_cast<base_reader&>(static_cast<attribute_reader&>(*this)), node.first, node_value, args...);
+					else
+						parser.parse_child_node(static_cast<base_reader&>(static_cast<attribute_reader&>(*this)), node.first, std::move(owned_node_value()), args...);
 				}
 				template<class element_parser_t, class...Args>//, typename identity<decltype(element_parser_t::parse_content)>::type = 0>
-				auto call_parse_content(element_parser_t&& parser, Args&&...args) { 
+				decltype(auto) call_parse_content(element_parser_t&& parser, Args&&...args) { 
 					return parser.parse_content(static_cast<base_reader&>(static_cast<attribute_reader&>(*this)), args...); 
 				}
 
-				//TODO: Handle attribute namespaces.
-				//TODO: Handle the xml namespace.
+				// For parallel_records. A worker reader is positioned directly at an offset inside the root element's content,
+				// and reads sibling records until it reaches stop_offset, or the root's close tag, in which case it returns true.
+				bool open_root(const char* root_tag);
+				std::uint64_t find_record_start(std::string_view pattern, std::uint64_t from) const;
+				void inherit_prolog(const reader& document);
+				void seek_root_content(std::uint64_t offset, symbol_id root_id);
+				void finish_root(std::uint64_t offset);
+				template<class child_parser_t, class add_record_t>
+				bool read_records(child_parser_t& parser, symbol_id record_id, std::uint64_t stop_offset, add_record_t&& add_record) {
+					while (buffer_idx < stop_offset) {
+						if (!next_node()) {
+							if (position.tag_depth != 0) throw_unexpeced_eof("missing close tag for " + symbols_->name(tag_ids[0]));
+							return true;
+						}
+						if (node.first == node_type::element_node) {
+							if (tag_ids[position.tag_depth] != record_id) throw_unexpected("unexpected tag " + symbols_->name(tag_ids[position.tag_depth]));
+							add_record(call_parse_tag(parser));
+						} else if (node.first == node_type::string_node && !mpd::trim(node_value).empty())
+							throw_unexpected();
+					}
+					return false;
+				}
+
 				friend document_reader;
+				friend cursor;
+				friend push_reader_members;
+				friend parallel_records;
 				template<class read_buff_t, class...Us>
-				reader(std::string&& source_name, std::in_place_type_t<read_buff_t> name, Us&&...us)
+				reader(std::string&& source_name, std::size_t buffer_size, std::in_place_type_t<read_buff_t> name, Us&&...us)
 					:tag_reader(*this)
 					, attribute_reader(*this)
 					, element_reader(*this)
-					, position(name, std::forward<Us>(us)...)
+					, source_(name, std::forward<Us>(us)...)
+					, symbols_(std::make_shared<symbol_table>())
+					, tag_ids(1, no_symbol)
 					, source_name_(std::move(source_name))
-					, attribute_count(0)
+					, buffer_size_(std::max(buffer_size, min_buffer_size))
 				{ }
+				// Contiguous sources have no read_buf, and are tokenized in place, without a staging buffer or refills.
+				reader(std::string&& source_name, std::string_view content)
+					:tag_reader(*this)
+					, attribute_reader(*this)
+					, element_reader(*this)
+					, symbols_(std::make_shared<symbol_table>())
+					, tag_ids(1, no_symbol)
+					, source_name_(std::move(source_name))
+					, window(content)
+				{ read_contiguous_encoding(); }
 				std::string get_parse_state_name();
 				std::string get_node_type_string(node_type type, const std::string& name);
 				void throw_invalid_read_call(const char* details = nullptr);
 				void throw_invalid_read_call(const std::string& details) { throw_invalid_read_call(details.c_str()); }
 				void throw_invalid_parser(const char* details = nullptr);
 				void throw_invalid_parser(const std::string& details) { throw_invalid_parser(details.c_str()); }
-				void throw_malformed_xml(const char* details = nullptr);
-				void throw_malformed_xml(const std::string& details) { throw_malformed_xml(details.c_str()); }
+				[[noreturn]] void throw_malformed_xml(const char* details = nullptr);
+				[[noreturn]] void throw_malformed_xml(const std::string& details) { throw_malformed_xml(details.c_str()); }
 				void throw_duplicate_attribute(const char* details = nullptr);
 				void throw_duplicate_attribute(const std::string& details) { throw_duplicate_attribute(details.c_str()); }
-				void throw_unexpeced_eof(const char* details = nullptr);
-				void throw_unexpeced_eof(const std::string& details) { throw_unexpeced_eof(details.c_str()); }
+				[[noreturn]] void throw_unexpeced_eof(const char* details = nullptr);
+				[[noreturn]] void throw_unexpeced_eof(const std::string& details) { throw_unexpeced_eof(details.c_str()); }
 				noinline(bool) next_attribute();
+				// Reads the next node and returns true, or returns false at a close tag or the end of the input.
 				noinline(bool) next_node();
+				// As next_node, but a DOCTYPE, which isn't a node, is read by itself, and returns nothing. The caller 
+				// then checks for the end of the input, which for a push_reader may only mean that more is yet to come.
+				enum class read_result { node, close_tag, nothing };
+				read_result read_node();
+				bool finish_tag();
 				char affirm_next_char(char c1, char c2, const char* message);
 				void skip_ws();
-				void read_name(std::string&);
+				symbol_id read_symbol();
+				void begin_attributes();
 				void read_attr(char quote);
 				void read_string();
 				bool read_tag_name();
+				void prescan_namespace_declarations();
+				bool scan_namespace_declarations(std::string_view tag);
+				void declare_namespace(symbol_id attribute, std::string_view value);
 				bool read_close_tag();
 				void read_comment();
 				void append_cdata();
+				bool append_until(std::string_view terminator);
+				bool skip_until(std::string_view terminator);
+				bool skip_tag();
+				void flush_node_value(std::uint64_t& span_begin);
+				void finish_node_value(std::uint64_t span_begin);
+				std::string& owned_node_value();
+				bool next_default_attribute();
+				void require_ws(const char* message);
+				void read_literal();
+				void read_external_id();
+				void read_internal_subset();
+				void read_entity_declaration();
 				void read_conditional();
 				void parse_attribute_list();
 				void read_doctype();
 				void read_element_type();
 				void read_notation();
 				void read_processing_instruction();
-				char consume_nonws();
-				void consume_nonws(int count);
-				char consume_maybe_ws();
+				char consume();
+				void consume(std::size_t count);
 				void consume_escape(std::string& out);
 				char peek();
-				char peek(int idx);
-				template<int len> bool peek(const char(&str)[len]) { return peek(str, len-1); }
-				bool peek(const char* str, int len);
+				char peek(std::size_t idx);
+				template<std::size_t len> bool peek(const char(&str)[len]) { return peek(str, len-1); }
+				bool peek(const char* str, std::size_t len);
 				bool at_eof();
 				void read_buffer();
+				void read_contiguous_encoding();
+				saved_pos save_position() { return saved_pos{ position, window_offset + buffer_idx }; }
+				void rollback(const saved_pos& saved);
+				void require_recoverable() {
+					if (position.state == parse_state::unrecoverable) throw_invalid_read_call("the reader is unrecoverable after an earlier error");
+				}
 			};
 
 			template<class forward_it>
@@ -212,17 +359,92 @@ namespace mpd {
 				virtual read_buf_impl* move_construct_at(char* buffer, std::size_t buffer_size) & //noexcept(noexcept(read_buf_impl{ std::move(*this) }))
 				{ assert(buffer_size > sizeof(read_buf_impl)); return new(buffer)read_buf_impl(std::move(*this)); }
 				virtual ~read_buf_impl() {};
-				virtual int read(char* buffer, int count) {
-					int c = 0;
-					while (c < count && begin_ != end_) {
-						*buffer = *begin_;
-						++buffer;
-						++begin_;
-						++c;
+				virtual std::size_t read(char* buffer, std::size_t count) {
+					if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<forward_it>::iterator_category>) {
+						std::size_t c = std::min(count, static_cast<std::size_t>(end_ - begin_));
+						std::copy_n(begin_, c, buffer);
+						begin_ += c;
+						return c;
+					} else {
+						std::size_t c = 0;
+						while (c < count && begin_ != end_) {
+							*buffer = *begin_;
+							++buffer;
+							++begin_;
+							++c;
+						}
+						return c;
 					}
-					return c;
 				}
 			};
+
+			// Sources that are read in bulk, one buffer at a time. 
+			// These hold the source by reference, so the source must outlive the document_reader.
+			class istream_read_buf final : public read_buf_t {
+				std::istream* stream_;
+			public:
+				explicit istream_read_buf(std::istream& stream) : stream_(&stream) {}
+				virtual istream_read_buf* copy_construct_at(char* buffer, std::size_t buffer_size)const&
+				{ assert(buffer_size > sizeof(istream_read_buf)); return new(buffer)istream_read_buf(*this); }
+				virtual istream_read_buf* move_construct_at(char* buffer, std::size_t buffer_size) &
+				{ assert(buffer_size > sizeof(istream_read_buf)); return new(buffer)istream_read_buf(std::move(*this)); }
+				virtual std::size_t read(char* buffer, std::size_t count);
+			};
+			class file_read_buf final : public read_buf_t {
+				std::FILE* file_;
+			public:
+				explicit file_read_buf(std::FILE* file) : file_(file) {}
+				virtual file_read_buf* copy_construct_at(char* buffer, std::size_t buffer_size)const&
+				{ assert(buffer_size > sizeof(file_read_buf)); return new(buffer)file_read_buf(*this); }
+				virtual file_read_buf* move_construct_at(char* buffer, std::size_t buffer_size) &
+				{ assert(buffer_size > sizeof(file_read_buf)); return new(buffer)file_read_buf(std::move(*this)); }
+				virtual std::size_t read(char* buffer, std::size_t count);
+			};
+			class fd_read_buf final : public read_buf_t {
+				int fd_;
+			public:
+				explicit fd_read_buf(int fd) : fd_(fd) {}
+				virtual fd_read_buf* copy_construct_at(char* buffer, std::size_t buffer_size)const&
+				{ assert(buffer_size > sizeof(fd_read_buf)); return new(buffer)fd_read_buf(*this); }
+				virtual fd_read_buf* move_construct_at(char* buffer, std::size_t buffer_size) &
+				{ assert(buffer_size > sizeof(fd_read_buf)); return new(buffer)fd_read_buf(std::move(*this)); }
+				virtual std::size_t read(char* buffer, std::size_t count);
+			};
+
+			// Wraps a source, and converts it to UTF-8 one chunk at a time as the reader refills, in whichever encoding
+			// transcoding_input detects. The conversion state is on the heap, to keep the read_buf within type_erased's storage.
+			template<class source_buf_t>
+			class transcoding_read_buf final : public read_buf_t {
+				source_buf_t source_;
+				std::unique_ptr<transcoding_input> input_;
+			public:
+				template<class...Us>
+				explicit transcoding_read_buf(Us&&...us) : source_(std::forward<Us>(us)...), input_(std::make_unique<transcoding_input>()) {}
+				transcoding_read_buf(const transcoding_read_buf& other) : source_(other.source_), input_(std::make_unique<transcoding_input>(*other.input_)) {}
+				transcoding_read_buf(transcoding_read_buf&& other) = default;
+				virtual transcoding_read_buf* copy_construct_at(char* buffer, std::size_t buffer_size)const&
+				{ assert(buffer_size > sizeof(transcoding_read_buf)); return new(buffer)transcoding_read_buf(*this); }
+				virtual transcoding_read_buf* move_construct_at(char* buffer, std::size_t buffer_size) &
+				{ assert(buffer_size > sizeof(transcoding_read_buf)); return new(buffer)transcoding_read_buf(std::move(*this)); }
+				virtual std::size_t read(char* buffer, std::size_t count) { return input_->read(source_, buffer, count); }
+				virtual bool more_input() const { return source_.more_input(); }
+			};
+
+			// Iterators over memory that the reader can tokenize in place, rather than copying through a read_buf_impl.
+			template<class forward_it>
+			struct is_contiguous_char_iterator : std::bool_constant<
+				std::is_same_v<forward_it, std::string::iterator>
+				|| std::is_same_v<forward_it, std::string::const_iterator>
+				|| std::is_same_v<forward_it, std::string_view::const_iterator>
+				|| std::is_same_v<forward_it, std::vector<char>::iterator>
+				|| std::is_same_v<forward_it, std::vector<char>::const_iterator>> {};
+			template<class T>
+			struct is_contiguous_char_iterator<T*> : std::bool_constant<sizeof(T) == 1 && std::is_integral_v<T>> {};
+			template<class contiguous_it>
+			std::string_view make_contiguous_view(contiguous_it begin, contiguous_it end) {
+				if (begin == end) return {};
+				return std::string_view(reinterpret_cast<const char*>(std::addressof(*begin)), static_cast<std::size_t>(end - begin));
+			}
 		}
 	}
 }
\ No newline at end of file
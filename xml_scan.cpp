@@ -0,0 +1,262 @@
+#include "xml_scan.hpp"
+#if defined(__AVX2__)
+#define MPD_XML_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MPD_XML_SSE2
+#endif
+#if defined(MPD_XML_AVX2)
+#include <immintrin.h>
+#elif defined(MPD_XML_SSE2)
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+#if defined(MPD_XML_SSE2) || defined(MPD_XML_AVX2)
+			static inline unsigned trailing_zeros(unsigned mask) {
+#ifdef _MSC_VER
+				unsigned long idx;
+				_BitScanForward(&idx, mask);
+				return idx;
+#else
+				return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+			}
+			static inline unsigned pop_count(unsigned mask) {
+#ifdef _MSC_VER
+				mask = mask - ((mask >> 1) & 0x55555555u);
+				mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+				return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#else
+				return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+			}
+#endif
+
+			std::size_t find_first_of(const char* data, std::size_t size, char a, char b, char c) {
+				std::size_t i = 0;
+#ifdef MPD_XML_AVX2
+				const __m256i wide_a = _mm256_set1_epi8(a);
+				const __m256i wide_b = _mm256_set1_epi8(b);
+				const __m256i wide_c = _mm256_set1_epi8(c);
+				for (; i + 32 <= size; i += 32) {
+					__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					__m256i matches = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_a), _mm256_cmpeq_epi8(chunk, wide_b)), _mm256_cmpeq_epi8(chunk, wide_c));
+					unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_a = _mm_set1_epi8(a);
+				const __m128i narrow_b = _mm_set1_epi8(b);
+				const __m128i narrow_c = _mm_set1_epi8(c);
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_a), _mm_cmpeq_epi8(chunk, narrow_b)), _mm_cmpeq_epi8(chunk, narrow_c));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+				for (; i < size; ++i) {
+					if (data[i] == a || data[i] == b || data[i] == c)
+						return i;
+				}
+				return size;
+			}
+
+			std::size_t count_char(const char* data, std::size_t size, char c) {
+				std::size_t i = 0;
+				std::size_t count = 0;
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_c = _mm_set1_epi8(c);
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					count += pop_count(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, narrow_c))));
+				}
+#endif
+				for (; i < size; ++i)
+					count += (data[i] == c);
+				return count;
+			}
+
+			// SSE2 has no unsigned byte compare, so bytes at or below ' ' are the ones unchanged by min(byte, ' ').
+			std::size_t find_space_or_control(const char* data, std::size_t size) {
+				std::size_t i = 0;
+#ifdef MPD_XML_AVX2
+				const __m256i wide_space = _mm256_set1_epi8(' ');
+				for (; i + 32 <= size; i += 32) {
+					__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, wide_space), chunk)));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_space = _mm_set1_epi8(' ');
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(chunk, narrow_space), chunk)));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+				for (; i < size; ++i) {
+					if (static_cast<unsigned char>(data[i]) <= ' ')
+						return i;
+				}
+				return size;
+			}
+
+			std::size_t skip_space_or_control(const char* data, std::size_t size) {
+				std::size_t i = 0;
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_space = _mm_set1_epi8(' ');
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(chunk, narrow_space), chunk))) ^ 0xFFFFu;
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+				for (; i < size; ++i) {
+					if (static_cast<unsigned char>(data[i]) > ' ')
+						return i;
+				}
+				return size;
+			}
+
+			// Control characters are the bytes unchanged by min(byte, ' '-1).
+			std::size_t find_attribute_escape(const char* data, std::size_t size) {
+				std::size_t i = 0;
+#ifdef MPD_XML_AVX2
+				const __m256i wide_lt = _mm256_set1_epi8('<');
+				const __m256i wide_amp = _mm256_set1_epi8('&');
+				const __m256i wide_quote = _mm256_set1_epi8('"');
+				const __m256i wide_control = _mm256_set1_epi8(' ' - 1);
+				for (; i + 32 <= size; i += 32) {
+					__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					__m256i matches = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_lt), _mm256_cmpeq_epi8(chunk, wide_amp)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_quote), _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, wide_control), chunk)));
+					unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_lt = _mm_set1_epi8('<');
+				const __m128i narrow_amp = _mm_set1_epi8('&');
+				const __m128i narrow_quote = _mm_set1_epi8('"');
+				const __m128i narrow_control = _mm_set1_epi8(' ' - 1);
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_lt), _mm_cmpeq_epi8(chunk, narrow_amp)),
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_quote), _mm_cmpeq_epi8(_mm_min_epu8(chunk, narrow_control), chunk)));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+				for (; i < size; ++i) {
+					char c = data[i];
+					if (c == '<' || c == '&' || c == '"' || static_cast<unsigned char>(c) < ' ')
+						return i;
+				}
+				return size;
+			}
+
+			// As find_attribute_escape, with '>' in place of '"', and tab and newline let through.
+			std::size_t find_text_escape(const char* data, std::size_t size) {
+				std::size_t i = 0;
+#ifdef MPD_XML_AVX2
+				const __m256i wide_lt = _mm256_set1_epi8('<');
+				const __m256i wide_amp = _mm256_set1_epi8('&');
+				const __m256i wide_gt = _mm256_set1_epi8('>');
+				const __m256i wide_control = _mm256_set1_epi8(' ' - 1);
+				const __m256i wide_tab = _mm256_set1_epi8('\t');
+				const __m256i wide_newline = _mm256_set1_epi8('\n');
+				for (; i + 32 <= size; i += 32) {
+					__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					__m256i controls = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_tab), _mm256_cmpeq_epi8(chunk, wide_newline)),
+						_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, wide_control), chunk));
+					__m256i matches = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_lt), _mm256_cmpeq_epi8(chunk, wide_amp)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wide_gt), controls));
+					unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+#ifdef MPD_XML_SSE2
+				const __m128i narrow_lt = _mm_set1_epi8('<');
+				const __m128i narrow_amp = _mm_set1_epi8('&');
+				const __m128i narrow_gt = _mm_set1_epi8('>');
+				const __m128i narrow_control = _mm_set1_epi8(' ' - 1);
+				const __m128i narrow_tab = _mm_set1_epi8('\t');
+				const __m128i narrow_newline = _mm_set1_epi8('\n');
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i controls = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_tab), _mm_cmpeq_epi8(chunk, narrow_newline)),
+						_mm_cmpeq_epi8(_mm_min_epu8(chunk, narrow_control), chunk));
+					__m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_lt), _mm_cmpeq_epi8(chunk, narrow_amp)),
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, narrow_gt), controls));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+					if (mask != 0) return i + trailing_zeros(mask);
+				}
+#endif
+				for (; i < size; ++i) {
+					char c = data[i];
+					if (c == '<' || c == '&' || c == '>' || (static_cast<unsigned char>(c) < ' ' && c != '\t' && c != '\n'))
+						return i;
+				}
+				return size;
+			}
+
+			std::size_t copy_ascii(const char* data, std::size_t size, char* out) {
+				std::size_t i = 0;
+#ifdef MPD_XML_AVX2
+				for (; i + 32 <= size; i += 32) {
+					__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					if (_mm256_movemask_epi8(chunk) != 0) break;
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), chunk);
+				}
+#endif
+#ifdef MPD_XML_SSE2
+				for (; i + 16 <= size; i += 16) {
+					__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					if (_mm_movemask_epi8(chunk) != 0) break;
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), chunk);
+				}
+#endif
+				for (; i < size && static_cast<signed char>(data[i]) >= 0; ++i)
+					out[i] = data[i];
+				return i;
+			}
+
+			// Sixteen units at a time: swapped to little endian if need be, checked for any bits above 0x7F, and packed to bytes.
+			std::size_t narrow_ascii_utf16(const char* data, std::size_t units, bool big_endian, char* out) {
+				std::size_t i = 0;
+#ifdef MPD_XML_SSE2
+				const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+				const __m128i zero = _mm_setzero_si128();
+				for (; i + 16 <= units; i += 16) {
+					__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * i));
+					__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * i + 16));
+					if (big_endian) {
+						low = _mm_or_si128(_mm_slli_epi16(low, 8), _mm_srli_epi16(low, 8));
+						high = _mm_or_si128(_mm_slli_epi16(high, 8), _mm_srli_epi16(high, 8));
+					}
+					__m128i wide = _mm_or_si128(_mm_and_si128(low, non_ascii), _mm_and_si128(high, non_ascii));
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(wide, zero)) != 0xFFFF) break;
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+				}
+#endif
+				for (; i < units; ++i) {
+					unsigned char first = static_cast<unsigned char>(data[2 * i]);
+					unsigned char second = static_cast<unsigned char>(data[2 * i + 1]);
+					unsigned unit = big_endian ? (first << 8 | second) : (second << 8 | first);
+					if (unit >= 0x80) break;
+					out[i] = static_cast<char>(unit);
+				}
+				return i;
+			}
+		}
+	}
+}
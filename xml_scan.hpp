@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			/**
+			Character classification and span scanning for the tokenizer.
+			The tokenizer finds the next "interesting" byte with a vectorized search, and then handles
+			everything before it as a single span, rather than a byte at a time.
+			**/
+			enum char_class : unsigned char {
+				whitespace_class = 1,
+				name_start_class = 2,
+				name_class = 4,
+			};
+			struct char_class_table {
+				unsigned char classes[256];
+			};
+			constexpr char_class_table make_char_class_table() {
+				char_class_table table = {};
+				table.classes[(unsigned char)' '] |= whitespace_class;
+				table.classes[(unsigned char)'\n'] |= whitespace_class;
+				table.classes[(unsigned char)'\t'] |= whitespace_class;
+				table.classes[(unsigned char)'\r'] |= whitespace_class;
+				for (int c = 0; c < 256; ++c) {
+					if (c == ':' || (c >= 'A' && c <= 'Z') || c == '_' || (c >= 'a' && c <= 'z') || c > 127)
+						table.classes[c] |= name_start_class | name_class;
+					if (c == '-' || c == '.' || (c >= '0' && c <= '9'))
+						table.classes[c] |= name_class;
+				}
+				return table;
+			}
+			inline constexpr char_class_table char_classes = make_char_class_table();
+
+			inline bool is_whitespace(char c)
+			{ return (char_classes.classes[static_cast<unsigned char>(c)] & whitespace_class) != 0; }
+			inline bool is_name_start_char(char c)
+			{ return (char_classes.classes[static_cast<unsigned char>(c)] & name_start_class) != 0; }
+			inline bool is_name_char(char c)
+			{ return (char_classes.classes[static_cast<unsigned char>(c)] & name_class) != 0; }
+
+			// Returns the index of the first byte in [data, data+size) that matches any of the needles, or size if there is none.
+			// Uses AVX2 or SSE2 when the build targets them, with a scalar fallback otherwise.
+			std::size_t find_first_of(const char* data, std::size_t size, char a, char b, char c);
+			inline std::size_t find_first_of(const char* data, std::size_t size, char a, char b)
+			{ return find_first_of(data, size, a, b, b); }
+			inline std::size_t find_first_of(const char* data, std::size_t size, char a)
+			{ return find_first_of(data, size, a, a, a); }
+			// Returns the number of bytes in [data, data+size) that equal c.
+			std::size_t count_char(const char* data, std::size_t size, char c);
+			// Returns the index of the first byte at or below ' ' (whitespace or a control character), or size if there is none.
+			std::size_t find_space_or_control(const char* data, std::size_t size);
+			// Returns the index of the first byte above ' ', or size if there is none.
+			std::size_t skip_space_or_control(const char* data, std::size_t size);
+			// Returns the index of the first byte that must be escaped in an attribute value ('<', '&', '"', or a control character), or size if there is none.
+			std::size_t find_attribute_escape(const char* data, std::size_t size);
+			// Returns the index of the first byte that must be escaped in text ('<', '&', '>', or a control character other than tab and newline), or size if there is none.
+			std::size_t find_text_escape(const char* data, std::size_t size);
+			// Copies the leading ASCII bytes of [data, data+size) to out, and returns how many there were.
+			std::size_t copy_ascii(const char* data, std::size_t size, char* out);
+			// Narrows the leading ASCII code units of the UTF-16 units in [data, data+2*units) to bytes in out, and returns how many there were.
+			std::size_t narrow_ascii_utf16(const char* data, std::size_t units, bool big_endian, char* out);
+		}
+	}
+}
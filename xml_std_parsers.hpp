@@ -1,7 +1,10 @@
 #pragma once
+#include "xml_numbers.hpp"
 #include "xml_parser_builder.hpp"
+#include <deque>
 #include <limits>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <queue>
 
@@ -50,6 +53,8 @@ namespace mpd {
 			}
 			template<class Container>
 			void emplace_back(Container& container, typename Container::type&& item) { container.emplace_back(std::move(item)); }
+			inline std::pmr::string pmr_string_parser(base_reader& reader, std::string_view content)
+			{ return std::pmr::string(content, reader.memory_resource()); }
 			template<class T>
 			void optional_emplace(std::optional<T>& container, T&& item) { container.emplace(std::move(item)); }
 		}
@@ -59,24 +64,85 @@ namespace mpd {
 		using signed_char_parser = mpd_xml_builder_text_only_parser(signed char, (impl::char_parser<signed char>));
 		using unsigned_char_parser = mpd_xml_builder_text_only_parser(unsigned char, (impl::char_parser<unsigned char>));
 
-		using byte_parser = mpd_xml_builder_text_only_parser(char, (impl::strtoi_parser<char, long, std::strtol>));
-		using signed_byte_parser = mpd_xml_builder_text_only_parser(signed char, (impl::strtoi_parser<signed char, long, std::strtol>));
-		using short_parser = mpd_xml_builder_text_only_parser(short, (impl::strtoi_parser<short, long, std::strtol>));
-		using int_parser = mpd_xml_builder_text_only_parser(int, (impl::strtoi_parser<int, long, std::strtol>));
-		using long_parser = mpd_xml_builder_text_only_parser(long, (impl::strtoi_parser<long, long, std::strtol>));
-		using long_long_parser = mpd_xml_builder_text_only_parser(long long, (impl::strtoi_parser<long long, long long, std::strtoll>));
+		using byte_parser = mpd_xml_builder_text_only_parser(char, (impl::from_chars_parser<char>));
+		using signed_byte_parser = mpd_xml_builder_text_only_parser(signed char, (impl::from_chars_parser<signed char>));
+		using short_parser = mpd_xml_builder_text_only_parser(short, (impl::from_chars_parser<short>));
+		using int_parser = mpd_xml_builder_text_only_parser(int, (impl::from_chars_parser<int>));
+		using long_parser = mpd_xml_builder_text_only_parser(long, (impl::from_chars_parser<long>));
+		using long_long_parser = mpd_xml_builder_text_only_parser(long long, (impl::from_chars_parser<long long>));
 
-		using unsigned_byte_parser = mpd_xml_builder_text_only_parser(unsigned char, (impl::strtoi_parser<unsigned char, unsigned long, std::strtoul>));
-		using unsigned_short_parser = mpd_xml_builder_text_only_parser(unsigned short, (impl::strtoi_parser<unsigned short, unsigned long, std::strtoul>));
-		using unsigned_int_parser = mpd_xml_builder_text_only_parser(unsigned int, (impl::strtoi_parser<unsigned int, unsigned long, std::strtoul>));
-		using unsigned_long_parser = mpd_xml_builder_text_only_parser(unsigned long, (impl::strtoi_parser<unsigned long, unsigned  long, std::strtoul>));
-		using unsigned_long_long_parser = mpd_xml_builder_text_only_parser(unsigned long long, (impl::strtoi_parser<unsigned long long, unsigned long long, std::strtoull>));
+		using unsigned_byte_parser = mpd_xml_builder_text_only_parser(unsigned char, (impl::from_chars_parser<unsigned char>));
+		using unsigned_short_parser = mpd_xml_builder_text_only_parser(unsigned short, (impl::from_chars_parser<unsigned short>));
+		using unsigned_int_parser = mpd_xml_builder_text_only_parser(unsigned int, (impl::from_chars_parser<unsigned int>));
+		using unsigned_long_parser = mpd_xml_builder_text_only_parser(unsigned long, (impl::from_chars_parser<unsigned long>));
+		using unsigned_long_long_parser = mpd_xml_builder_text_only_parser(unsigned long long, (impl::from_chars_parser<unsigned long long>));
 
-		using float_parser = mpd_xml_builder_text_only_parser(float, (impl::strtof_parser<float, std::strtof>));
-		using double_parser = mpd_xml_builder_text_only_parser(double, (impl::strtof_parser<double, std::strtod>));
-		using long_double_parser = mpd_xml_builder_text_only_parser(long double, (impl::strtof_parser<long double, std::strtold>));
+		using float_parser = mpd_xml_builder_text_only_parser(float, (impl::from_chars_parser<float>));
+		using double_parser = mpd_xml_builder_text_only_parser(double, (impl::from_chars_parser<double>));
+		using long_double_parser = mpd_xml_builder_text_only_parser(long double, (impl::from_chars_parser<long double>));
+
+		// Parses an element of whitespace separated numbers, such as <values>1 2.5 -3e4</values>, into a std::vector<T>.
+		// Comments and processing instructions between the numbers are skipped.
+		template<class T>
+		struct numeric_array_parser {
+			private: std::vector<T> values;
+			public:
+				using element_type = std::vector<T>;
+				void reset()
+				{ values.clear(); }
+				std::vector<T> parse_tag(tag_reader& reader, const std::string&)
+				{ return reader.read_element(*this); }
+				void parse_attribute(attribute_reader& reader, const std::string& name, std::string_view)
+				{ reader.throw_unexpected("unexpected attribute " + name); }
+				numeric_array_parser& parse_content(base_reader&)
+				{ return *this; }
+				void parse_child_element(element_reader& reader, const std::string&)
+				{ reader.throw_unexpected(); }
+				void parse_child_node(base_reader& reader, node_type type, std::string_view content) {
+					if (type == node_type::comment_node || type == node_type::processing_node) return;
+					if (type != node_type::string_node) reader.throw_unexpected();
+					impl::parse_number_list<T>(reader, content, [this](T value) { values.push_back(value); });
+				}
+				std::vector<T> end_parse(base_reader&)
+				{ return std::move(values); }
+				void write_element(document_writer& writer, const char* tag, const std::vector<T>& item) const {
+					writer.start_element(tag);
+					writer.number_list(item);
+					writer.end_element();
+				}
+		};
+		// As numeric_array_parser, but writes into caller owned storage, and returns the number of values written.
+		template<class T>
+		struct numeric_span_parser {
+			private:
+				T* first;
+				T* last;
+				T* next;
+			public:
+				using element_type = std::size_t;
+				numeric_span_parser(T* data, std::size_t capacity) : first(data), last(data + capacity), next(data) {}
+				void reset()
+				{ next = first; }
+				std::size_t parse_tag(tag_reader& reader, const std::string&)
+				{ return reader.read_element(*this); }
+				void parse_attribute(attribute_reader& reader, const std::string& name, std::string_view)
+				{ reader.throw_unexpected("unexpected attribute " + name); }
+				numeric_span_parser& parse_content(base_reader&)
+				{ return *this; }
+				void parse_child_element(element_reader& reader, const std::string&)
+				{ reader.throw_unexpected(); }
+				void parse_child_node(base_reader& reader, node_type type, std::string_view content) {
+					if (type == node_type::comment_node || type == node_type::processing_node) return;
+					if (type != node_type::string_node) reader.throw_unexpected();
+					impl::parse_number_list<T>(reader, content, [this, &reader](T value) {
+						if (next == last) reader.throw_invalid_content("more than " + std::to_string(last - first) + " numbers");
+						*next++ = value;
+					});
+				}
+				std::size_t end_parse(base_reader&)
+				{ return static_cast<std::size_t>(next - first); }
+		};
 
-		
 		template<class T, const char* tag, class element_parser_t>
 		using vector_parser = builder::parser<std::vector<T>, std::tuple<mpd_xml_builder_element_repeating(tag, element_parser_t, &std::vector<T>::template emplace_back<T&&>)>>;
 		template<class T, const char* tag, class element_parser_t>
@@ -86,6 +152,18 @@ namespace mpd {
 		template<class T, const char* tag, class element_parser_t>
 		using optional_parser = builder::parser<std::optional<T>, std::tuple<mpd_xml_builder_element_optional(tag, element_parser_t, &std::optional<T>::template emplace<T&&>)>>;
 
+		// As above, but the results allocate from the document_reader's memory resource (see document_reader#use_memory_resource),
+		// so that a whole parsed tree can live in one arena and be released at once.
+		namespace pmr {
+			using trimmed_string_parser = mpd_xml_builder_text_only_parser(std::pmr::string, impl::pmr_string_parser);
+			template<class T, const char* tag, class element_parser_t>
+			using vector_parser = builder::parser<std::pmr::vector<T>, std::tuple<mpd_xml_builder_element_repeating(tag, element_parser_t, &std::pmr::vector<T>::template emplace_back<T&&>)>>;
+			template<class T, const char* tag, class element_parser_t>
+			using list_parser = builder::parser<std::pmr::list<T>, std::tuple<mpd_xml_builder_element_repeating(tag, element_parser_t, &std::pmr::list<T>::template emplace_back<T&&>)>>;
+			template<class T, const char* tag, class element_parser_t>
+			using deque_parser = builder::parser<std::pmr::deque<T>, std::tuple<mpd_xml_builder_element_repeating(tag, element_parser_t, &std::pmr::deque<T>::template emplace_back<T&&>)>>;
+		}
+
 		//TODO: maps... using id as key?
 	}
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "xml_symbols.hpp"
+
+namespace mpd {
+	namespace xml {
+		static std::uint64_t hash_name(std::string_view name) { //FNV-1a
+			std::uint64_t hash = 14695981039346656037ull;
+			for (char c : name) {
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+		symbol_table::symbol_table() : slots_(64, no_symbol) {}
+		symbol_id symbol_table::find(std::string_view name, std::uint64_t hash) const {
+			std::size_t mask = slots_.size() - 1;
+			for (std::size_t slot = static_cast<std::size_t>(hash) & mask; ; slot = (slot + 1) & mask) {
+				symbol_id id = slots_[slot];
+				if (id == no_symbol) return no_symbol;
+				if (hashes_[id] == hash && names_[id] == name) return id;
+			}
+		}
+		symbol_id symbol_table::find(std::string_view name) const {
+			return find(name, hash_name(name));
+		}
+		symbol_id symbol_table::intern(std::string_view name) {
+			std::uint64_t hash = hash_name(name);
+			symbol_id id = find(name, hash);
+			if (id != no_symbol) return id;
+			if ((names_.size() + 1) * 2 > slots_.size()) grow();
+			id = static_cast<symbol_id>(names_.size());
+			names_.emplace_back(name);
+			hashes_.push_back(hash);
+			std::size_t mask = slots_.size() - 1;
+			std::size_t slot = static_cast<std::size_t>(hash) & mask;
+			while (slots_[slot] != no_symbol) slot = (slot + 1) & mask;
+			slots_[slot] = id;
+			return id;
+		}
+		void symbol_table::grow() {
+			std::vector<symbol_id> slots(slots_.size() * 2, no_symbol);
+			std::size_t mask = slots.size() - 1;
+			for (symbol_id id = 0; id < names_.size(); ++id) {
+				std::size_t slot = static_cast<std::size_t>(hashes_[id]) & mask;
+				while (slots[slot] != no_symbol) slot = (slot + 1) & mask;
+				slots[slot] = id;
+			}
+			slots_ = std::move(slots);
+		}
+	}
+}
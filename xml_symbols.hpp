@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		using symbol_id = std::uint32_t;
+		static constexpr symbol_id no_symbol = UINT32_MAX;
+
+		/**
+		Interns element and attribute names, so that each distinct name is stored once and can be
+		identified by a small integer. Ids are dense and start at zero, so they may index arrays.
+		Each document_reader has its own table by default, but a table may be shared by several
+		document_readers (one at a time, it's not thread safe) so that ids stay the same across documents.
+		**/
+		class symbol_table {
+			std::deque<std::string> names_; //deque so that references to names are never invalidated
+			std::vector<std::uint64_t> hashes_;
+			std::vector<symbol_id> slots_; //open addressing, power of two size. no_symbol is an empty slot.
+			symbol_id find(std::string_view name, std::uint64_t hash) const;
+			void grow();
+		public:
+			symbol_table();
+			// Returns the id for name, adding it if it's not in the table yet.
+			symbol_id intern(std::string_view name);
+			// Returns the id for name, or no_symbol if it's not in the table.
+			symbol_id find(std::string_view name) const;
+			const std::string& name(symbol_id id) const { return names_[id]; }
+			std::size_t size() const { return names_.size(); }
+		};
+	}
+}
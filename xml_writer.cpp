@@ -0,0 +1,230 @@
+#include "xml_writer.hpp"
+#include "xml_scan.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			namespace {
+				class ostream_write_sink final : public write_sink {
+					std::ostream* stream_;
+				public:
+					explicit ostream_write_sink(std::ostream& stream) : stream_(&stream) {}
+					void write(const char* data, std::size_t size) override {
+						stream_->write(data, static_cast<std::streamsize>(size));
+						if (stream_->bad()) throw std::ios_base::failure("error writing to stream");
+					}
+					void flush() override { stream_->flush(); }
+				};
+				class file_write_sink final : public write_sink {
+					std::FILE* file_;
+				public:
+					explicit file_write_sink(std::FILE* file) : file_(file) {}
+					void write(const char* data, std::size_t size) override {
+						if (std::fwrite(data, 1, size, file_) != size) throw std::system_error(errno, std::generic_category(), "error writing to FILE");
+					}
+					void flush() override {
+						if (std::fflush(file_) != 0) throw std::system_error(errno, std::generic_category(), "error flushing FILE");
+					}
+				};
+				class fd_write_sink : public write_sink {
+				protected:
+					int fd_;
+				public:
+					explicit fd_write_sink(int fd) : fd_(fd) {}
+					void write(const char* data, std::size_t size) override {
+						while (size > 0) { //pipes and sockets accept short writes, so keep going until it's all written
+#ifdef _WIN32
+							int written = ::_write(fd_, data, static_cast<unsigned int>(std::min<std::size_t>(size, INT_MAX)));
+#else
+							ssize_t written = ::write(fd_, data, size);
+							if (written < 0 && errno == EINTR) continue;
+#endif
+							if (written < 0) throw std::system_error(errno, std::generic_category(), "error writing to file descriptor");
+							data += written;
+							size -= static_cast<std::size_t>(written);
+						}
+					}
+				};
+				class owned_fd_write_sink final : public fd_write_sink {
+				public:
+					explicit owned_fd_write_sink(const std::filesystem::path& path) : fd_write_sink(open(path)) {}
+					~owned_fd_write_sink() {
+#ifdef _WIN32
+						::_close(fd_);
+#else
+						::close(fd_);
+#endif
+					}
+					static int open(const std::filesystem::path& path) {
+#ifdef _WIN32
+						int fd = ::_wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+						int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+#endif
+						if (fd < 0) throw std::system_error(errno, std::generic_category(), "could not create " + path.string());
+						return fd;
+					}
+				};
+			}
+		}
+
+		document_writer::document_writer()
+			: buffer_size_(SIZE_MAX)
+		{}
+		document_writer::document_writer(std::ostream& stream, std::size_t buffer_size)
+			: buffer_size_(buffer_size), sink_(std::make_unique<impl::ostream_write_sink>(stream))
+		{ buffer_.reserve(buffer_size_); }
+		document_writer::document_writer(std::FILE* file, std::size_t buffer_size)
+			: buffer_size_(buffer_size), sink_(std::make_unique<impl::file_write_sink>(file))
+		{ buffer_.reserve(buffer_size_); }
+		document_writer::document_writer(int fd, std::size_t buffer_size)
+			: buffer_size_(buffer_size), sink_(std::make_unique<impl::fd_write_sink>(fd))
+		{ buffer_.reserve(buffer_size_); }
+		document_writer::document_writer(const std::filesystem::path& path, std::size_t buffer_size)
+			: buffer_size_(buffer_size), sink_(std::make_unique<impl::owned_fd_write_sink>(path))
+		{ buffer_.reserve(buffer_size_); }
+		document_writer::~document_writer() {
+			try { flush(); }
+			catch (const std::exception&) {}
+		}
+
+		void document_writer::declaration() {
+			if (!buffer_.empty() || depth() != 0) throw_misuse("the declaration must be the first thing written");
+			append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+		}
+		void document_writer::start_element(std::string_view name) {
+			close_start_tag();
+			buffer_.push_back('<');
+			buffer_.append(name.data(), name.size());
+			names_.append(name.data(), name.size());
+			name_ends_.push_back(names_.size());
+			tag_open_ = true;
+		}
+		void document_writer::attribute(std::string_view name, std::string_view value) {
+			if (!tag_open_) throw_misuse("attributes must be written right after start_element");
+			buffer_.push_back(' ');
+			buffer_.append(name.data(), name.size());
+			buffer_.append("=\"", 2);
+			append_attribute_escaped(value);
+			buffer_.push_back('"');
+		}
+		void document_writer::text(std::string_view content) {
+			close_start_tag();
+			append_text_escaped(content);
+		}
+		void document_writer::cdata(std::string_view content) {
+			close_start_tag();
+			buffer_.append("<![CDATA[", 9);
+			for (std::size_t end; (end = content.find("]]>")) != std::string_view::npos; content.remove_prefix(end + 2)) {
+				buffer_.append(content.data(), end + 2);
+				buffer_.append("]]><![CDATA[", 12);
+			}
+			buffer_.append(content.data(), content.size());
+			append("]]>");
+		}
+		void document_writer::comment(std::string_view content) {
+			if (content.find("--") != std::string_view::npos || (!content.empty() && content.back() == '-'))
+				throw_misuse("comments can't contain -- or end with -");
+			close_start_tag();
+			buffer_.append("<!--", 4);
+			buffer_.append(content.data(), content.size());
+			append("-->");
+		}
+		void document_writer::processing_instruction(std::string_view target, std::string_view content) {
+			if (content.find("?>") != std::string_view::npos) throw_misuse("processing instructions can't contain ?>");
+			close_start_tag();
+			buffer_.append("<?", 2);
+			buffer_.append(target.data(), target.size());
+			if (!content.empty()) {
+				buffer_.push_back(' ');
+				buffer_.append(content.data(), content.size());
+			}
+			append("?>");
+		}
+		void document_writer::end_element() {
+			if (name_ends_.empty()) throw_misuse("end_element without an open element");
+			name_ends_.pop_back();
+			std::size_t name_begin = name_ends_.empty() ? 0 : name_ends_.back();
+			if (tag_open_) {
+				buffer_.append("/>", 2);
+				tag_open_ = false;
+			}
+			else {
+				buffer_.append("</", 2);
+				buffer_.append(names_, name_begin, std::string::npos);
+				buffer_.push_back('>');
+			}
+			names_.resize(name_begin);
+			if (buffer_.size() >= buffer_size_) flush_buffer();
+		}
+
+		void document_writer::flush() {
+			if (!sink_) return;
+			flush_buffer();
+			sink_->flush();
+		}
+		void document_writer::clear() {
+			buffer_.clear();
+			names_.clear();
+			name_ends_.clear();
+			tag_open_ = false;
+		}
+
+		// Spans without special characters are copied whole, so the escaping costs one vectorized scan.
+		// A carriage return is written as a character reference, since XML readers normalize line ends to a newline.
+		void document_writer::append_text_escaped(std::string_view content) {
+			while (!content.empty()) {
+				std::size_t span = impl::find_text_escape(content.data(), content.size());
+				buffer_.append(content.data(), span);
+				if (span == content.size()) break;
+				switch (content[span]) {
+				case '<': buffer_.append("&lt;", 4); break;
+				case '&': buffer_.append("&amp;", 5); break;
+				case '>': buffer_.append("&gt;", 4); break;
+				case '\r': buffer_.append("&#13;", 5); break;
+				default: throw_misuse("text can't contain control characters other than tab, newline and carriage return");
+				}
+				content.remove_prefix(span + 1);
+			}
+			if (buffer_.size() >= buffer_size_) flush_buffer();
+		}
+		// Whitespace other than spaces is written as a character reference, since XML readers normalize it to a space in attributes.
+		void document_writer::append_attribute_escaped(std::string_view content) {
+			while (!content.empty()) {
+				std::size_t span = impl::find_attribute_escape(content.data(), content.size());
+				buffer_.append(content.data(), span);
+				if (span == content.size()) break;
+				switch (content[span]) {
+				case '<': buffer_.append("&lt;", 4); break;
+				case '&': buffer_.append("&amp;", 5); break;
+				case '"': buffer_.append("&quot;", 6); break;
+				case '\t': buffer_.append("&#9;", 4); break;
+				case '\n': buffer_.append("&#10;", 5); break;
+				case '\r': buffer_.append("&#13;", 5); break;
+				default: throw_misuse("attribute values can't contain control characters");
+				}
+				content.remove_prefix(span + 1);
+			}
+		}
+		void document_writer::flush_buffer() {
+			if (!sink_ || buffer_.empty()) return;
+			sink_->write(buffer_.data(), buffer_.size());
+			buffer_.clear();
+		}
+		void document_writer::throw_misuse(const char* details) {
+			throw std::logic_error(std::string("document_writer: ") + details);
+		}
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mpd {
+	namespace xml {
+		namespace impl {
+			// Where a document_writer sends its buffer each time it fills.
+			struct write_sink {
+				virtual ~write_sink() = default;
+				virtual void write(const char* data, std::size_t size) = 0;
+				virtual void flush() {}
+			};
+			constexpr std::size_t default_write_buffer_size = 1024 * 1024;
+
+			template<class T> struct is_optional : std::false_type {};
+			template<class T> struct is_optional<std::optional<T>> : std::true_type {};
+			template<class T> constexpr bool is_optional_v = is_optional<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+			template<class T> constexpr bool is_number_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>;
+		}
+
+		/**
+		Writes XML into one reusable buffer, which is sent to a stream, FILE*, file descriptor or file each time it fills,
+		or kept in memory until view() and clear(). Text and attribute values are escaped with a vectorized scan, and
+		numbers are formatted with std::to_chars. Once the buffer and the open element names have grown to their largest,
+		writing allocates nothing.
+
+			mpd::xml::document_writer writer(std::cout);
+			writer.start_element("one");
+			writer.attribute("attr1", 1);
+			writer.write_child("two", two_parser{}, data.nodes[0]);
+			writer.end_element();
+
+		Parsers may also write what they parse, with a method mirroring parse_tag. The builder parsers implement it from
+		their declarations, and write_child calls it:
+
+			void write_element(document_writer& writer, const char* tag, const element_type& item) const;
+
+		Errors from the sink are thrown as std::system_error or std::ios_base::failure, and misuse, such as an attribute
+		after content, as std::logic_error. The destructor flushes, but ignores errors, so call flush() to see them.
+		**/
+		class document_writer {
+		public:
+			// Keeps the document in memory. It's in view(), and clear() starts another in the same buffer.
+			document_writer();
+			explicit document_writer(std::ostream& stream, std::size_t buffer_size = impl::default_write_buffer_size);
+			explicit document_writer(std::FILE* file, std::size_t buffer_size = impl::default_write_buffer_size);
+			// Writes directly to the descriptor, with no buffering between it and this writer.
+			explicit document_writer(int fd, std::size_t buffer_size = impl::default_write_buffer_size);
+			// Creates or truncates the file, and writes to it as with a file descriptor.
+			explicit document_writer(const std::filesystem::path& path, std::size_t buffer_size = impl::default_write_buffer_size);
+			document_writer(const document_writer&) = delete;
+			document_writer& operator=(const document_writer&) = delete;
+			~document_writer();
+
+			// Writes <?xml version="1.0" encoding="UTF-8"?>
+			void declaration();
+			void start_element(std::string_view name);
+			// Only between start_element and its content. A std::optional attribute is only written if it has a value.
+			void attribute(std::string_view name, std::string_view value);
+			template<class T>
+			void attribute(std::string_view name, const T& value);
+			// Throws std::logic_error for control characters, which XML can't hold, other than tab, newline and carriage return.
+			void text(std::string_view content);
+			template<class T>
+			void text(const T& value);
+			// Writes each number, separated by spaces, as numeric_array_parser reads them.
+			template<class range_t>
+			void number_list(const range_t& numbers);
+			// Content containing "]]>" is split across two CDATA sections.
+			void cdata(std::string_view content);
+			void comment(std::string_view content);
+			void processing_instruction(std::string_view target, std::string_view content);
+			// Closes the innermost open element, as <name/> if it had no content.
+			void end_element();
+			// Writes item as an element named tag, with child_writer_t#write_element.
+			template<class child_writer_t, class T>
+			void write_child(const char* tag, const child_writer_t& writer, const T& item)
+			{ writer.write_element(*this, tag, item); }
+
+			// The number of open elements.
+			std::size_t depth() const { return name_ends_.size(); }
+			// Sends everything written so far to the sink, and flushes the sink. Does nothing in memory.
+			void flush();
+			// The document written so far, when writing to memory.
+			std::string_view view() const { return buffer_; }
+			// Discards everything written so far, and any open elements, keeping the buffer's capacity.
+			void clear();
+		private:
+			template<class T>
+			static std::string_view format_number(char(&digits)[64], T value);
+			void append(std::string_view content) {
+				buffer_.append(content.data(), content.size());
+				if (buffer_.size() >= buffer_size_) flush_buffer();
+			}
+			void append_text_escaped(std::string_view content);
+			void append_attribute_escaped(std::string_view content);
+			void close_start_tag() {
+				if (tag_open_) { buffer_.push_back('>'); tag_open_ = false; }
+			}
+			void flush_buffer();
+			[[noreturn]] void throw_misuse(const char* details);
+
+			std::string buffer_;
+			std::size_t buffer_size_;
+			std::unique_ptr<impl::write_sink> sink_;
+			std::string names_; //the names of the open elements, one after another
+			std::vector<std::size_t> name_ends_;
+			bool tag_open_ = false; //the last start tag is still waiting for its '>', so that attributes can be added, or it can be closed with "/>"
+		};
+
+		template<class T>
+		std::string_view document_writer::format_number(char(&digits)[64], T value) {
+			std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+			return std::string_view(digits, static_cast<std::size_t>(result.ptr - digits));
+		}
+		template<class T>
+		void document_writer::attribute(std::string_view name, const T& value) {
+			if constexpr (impl::is_optional_v<T>) {
+				if (value.has_value()) attribute(name, *value);
+			}
+			else if constexpr (impl::is_number_v<T>) {
+				char digits[64];
+				attribute(name, format_number(digits, value));
+			}
+			else if constexpr (std::is_same_v<T, bool>) attribute(name, value ? "true" : "false");
+			else if constexpr (std::is_same_v<T, char>) attribute(name, std::string_view(&value, 1));
+			else attribute(name, std::string_view(value));
+		}
+		template<class T>
+		void document_writer::text(const T& value) {
+			if constexpr (impl::is_optional_v<T>) {
+				if (value.has_value()) text(*value);
+			}
+			else if constexpr (impl::is_number_v<T>) {
+				char digits[64];
+				close_start_tag();
+				append(format_number(digits, value));
+			}
+			else if constexpr (std::is_same_v<T, bool>) text(value ? "true" : "false");
+			else if constexpr (std::is_same_v<T, char>) text(std::string_view(&value, 1));
+			else text(std::string_view(value));
+		}
+		template<class range_t>
+		void document_writer::number_list(const range_t& numbers) {
+			close_start_tag();
+			char digits[64];
+			bool first = true;
+			for (const auto& number : numbers) {
+				if (!first) buffer_.push_back(' ');
+				first = false;
+				append(format_number(digits, number));
+			}
+		}
+	}
+}